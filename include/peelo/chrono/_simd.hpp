@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2016-2024, peelo.net
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include <type_traits>
+
+/**
+ * Vectorized kernels used by the parsers, available on x86 when compiled
+ * with GCC or Clang. Define `PEELO_CHRONO_NO_SIMD` to always use the scalar
+ * implementations instead.
+ */
+#if !defined(PEELO_CHRONO_NO_SIMD) \
+  && (defined(__x86_64__) || defined(__i386__)) \
+  && (defined(__GNUC__) || defined(__clang__))
+#  define PEELO_CHRONO_SIMD_SSSE3 1
+#  include <immintrin.h>
+#endif
+
+/**
+ * Evaluates to true when called during constant evaluation, so that
+ * constexpr functions can avoid the vectorized kernels. Without compiler
+ * support the kernels are never used from constexpr functions.
+ */
+#if defined(__cpp_lib_is_constant_evaluated)
+#  define PEELO_CHRONO_IS_CONSTANT_EVALUATED() std::is_constant_evaluated()
+#elif defined(__has_builtin)
+#  if __has_builtin(__builtin_is_constant_evaluated)
+#    define PEELO_CHRONO_IS_CONSTANT_EVALUATED() \
+       __builtin_is_constant_evaluated()
+#  endif
+#endif
+#if !defined(PEELO_CHRONO_IS_CONSTANT_EVALUATED)
+#  undef PEELO_CHRONO_SIMD_SSSE3
+#endif
+
+#if defined(PEELO_CHRONO_SIMD_SSSE3)
+#include <cstdint>
+
+namespace peelo::chrono::utils::simd
+{
+  /**
+   * Whether the processor supports SSSE3. Detected once at startup, or not
+   * at all when the compiler may already assume SSSE3.
+   */
+#if defined(__SSSE3__)
+  inline constexpr bool has_ssse3 = true;
+#else
+  inline const bool has_ssse3 = (
+    __builtin_cpu_init(),
+    __builtin_cpu_supports("ssse3")
+  );
+#endif
+
+  /**
+   * Parses date and time in "YYYY-MM-DD?hh:mm:ss" format, where the
+   * character between the date and the time is not checked, from exactly 19
+   * characters of given input. Only the shape of the input is validated,
+   * not the values.
+   *
+   * The input is read with two overlapping 16 byte loads. Digits are
+   * gathered into a single register with a shuffle, validated with a
+   * saturating addition, and combined into two digit values with a single
+   * multiply-add.
+   *
+   * \param input  Pointer to at least 19 readable characters
+   * \param fields Receives year, month, day, hour, minute and second
+   * \return       A boolean flag indicating whether the input has correct
+   *               shape
+   */
+  __attribute__((target("ssse3")))
+  inline bool parse_date_time(const char* input, int fields[6]) noexcept
+  {
+    const auto low = _mm_loadu_si128(
+      reinterpret_cast<const __m128i*>(input)
+    );
+    const auto high = _mm_loadu_si128(
+      reinterpret_cast<const __m128i*>(input + 3)
+    );
+    const auto gathered = _mm_or_si128(
+      _mm_or_si128(
+        _mm_shuffle_epi8(
+          low,
+          _mm_setr_epi8(0, 1, 2, 3, 5, 6, 8, 9, 11, 12, 14, 15, -1, -1, -1, -1)
+        ),
+        _mm_shuffle_epi8(
+          high,
+          _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 14, 15,
+                        -1, -1)
+        )
+      ),
+      _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, '0', '0')
+    );
+    const auto digits = _mm_sub_epi8(gathered, _mm_set1_epi8('0'));
+    const auto invalid_digits = _mm_movemask_epi8(
+      _mm_adds_epu8(digits, _mm_set1_epi8(118))
+    );
+    const auto separators = _mm_movemask_epi8(_mm_cmpeq_epi8(
+      low,
+      _mm_setr_epi8(0, 0, 0, 0, '-', 0, 0, '-', 0, 0, 0, 0, 0, ':', 0, 0)
+    )) & 0x2090;
+
+    if ((invalid_digits != 0) | (separators != 0x2090) | (input[16] != ':'))
+    {
+      return false;
+    }
+
+    const auto values = _mm_maddubs_epi16(digits, _mm_set1_epi16(0x010a));
+
+    fields[0] = _mm_extract_epi16(values, 0) * 100
+      + _mm_extract_epi16(values, 1);
+    fields[1] = _mm_extract_epi16(values, 2);
+    fields[2] = _mm_extract_epi16(values, 3);
+    fields[3] = _mm_extract_epi16(values, 4);
+    fields[4] = _mm_extract_epi16(values, 5);
+    fields[5] = _mm_extract_epi16(values, 6);
+
+    return true;
+  }
+}
+#endif
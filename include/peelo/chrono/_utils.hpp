@@ -25,8 +25,13 @@
  */
 #pragma once
 
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
 #include <ctime>
 #include <stdexcept>
+#include <string>
+#include <string_view>
 #if !defined(_WIN32) && !defined(__unix__)
 #  include <thread>
 #endif
@@ -36,8 +41,411 @@
 #  include <windows.h>
 #endif
 
+#include <peelo/chrono/_simd.hpp>
+
+/**
+ * Throws given exception, or aborts the program when compiled without
+ * exception support.
+ */
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+#  define PEELO_CHRONO_THROW(exception) throw exception
+#else
+#  define PEELO_CHRONO_THROW(exception) std::abort()
+#endif
+
 namespace peelo::chrono::utils
 {
+  /**
+   * Broken down Gregorian calendar date, used by the day number conversion
+   * functions below. Unlike `peelo::chrono::month`, the month is one indexed.
+   */
+  struct civil
+  {
+    /** Year of the date. */
+    std::int64_t year;
+    /** Month of the year (from 1 to 12). */
+    int month;
+    /** Day of the month (from 1 to 31). */
+    int day;
+  };
+
+  /**
+   * Converts Gregorian calendar date into number of days since UNIX epoch
+   * (1970-01-01). Works on proleptic Gregorian calendar and does not depend on
+   * the time zone of the process in any way.
+   *
+   * \param year  Year of the date
+   * \param month Month of the year (from 1 to 12)
+   * \param day   Day of the month (from 1 to 31)
+   */
+  constexpr std::int64_t days_from_civil(
+    std::int64_t year,
+    int month,
+    int day
+  ) noexcept
+  {
+    // Shift the year to begin from March, so that the leap day is the last
+    // day of the year.
+    const auto y = year - (month <= 2);
+    const auto era = (y >= 0 ? y : y - 399) / 400;
+    const auto yoe = static_cast<unsigned>(y - era * 400);
+    const auto doy = static_cast<unsigned>(
+      (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1
+    );
+    const auto doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+
+    return era * 146097 + static_cast<std::int64_t>(doe) - 719468;
+  }
+
+  /**
+   * Converts number of days since UNIX epoch (1970-01-01) into Gregorian
+   * calendar date. Inverse of `days_from_civil()`.
+   *
+   * \param days Number of days since UNIX epoch
+   */
+  constexpr civil civil_from_days(std::int64_t days) noexcept
+  {
+    const auto z = days + 719468;
+    const auto era = (z >= 0 ? z : z - 146096) / 146097;
+    const auto doe = static_cast<unsigned>(z - era * 146097);
+    const auto yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const auto doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const auto mp = (5 * doy + 2) / 153;
+    const auto month = static_cast<int>(mp < 10 ? mp + 3 : mp - 9);
+
+    return {
+      static_cast<std::int64_t>(yoe) + era * 400 + (month <= 2),
+      month,
+      static_cast<int>(doy - (153 * mp + 2) / 5 + 1)
+    };
+  }
+
+  /**
+   * Returns day of the week (from 0 to 6, where 0 is Sunday) for given number
+   * of days since UNIX epoch (1970-01-01), which was a Thursday.
+   *
+   * \param days Number of days since UNIX epoch
+   */
+  constexpr int weekday_from_days(std::int64_t days) noexcept
+  {
+    return static_cast<int>(days >= -4 ? (days + 4) % 7 : (days + 5) % 7 + 6);
+  }
+
+  /**
+   * Returns value of given decimal digit, or a value greater than 9 when the
+   * character is not a decimal digit.
+   */
+  constexpr unsigned digit_value(char c) noexcept
+  {
+    return static_cast<unsigned>(static_cast<unsigned char>(c)) - '0';
+  }
+
+  /**
+   * Parses exactly given number of decimal digits from given position of
+   * the input, advancing the position past them.
+   *
+   * \return A boolean flag indicating whether the digits were present
+   */
+  constexpr bool parse_digits(
+    std::string_view input,
+    std::size_t& position,
+    std::size_t count,
+    int& result
+  ) noexcept
+  {
+    result = 0;
+    for (std::size_t i = 0; i < count; ++i, ++position)
+    {
+      const auto value = position < input.length()
+        ? digit_value(input[position])
+        : 10;
+
+      if (value > 9)
+      {
+        return false;
+      }
+      result = result * 10 + static_cast<int>(value);
+    }
+
+    return true;
+  }
+
+  /**
+   * Parses ISO 8601 calendar date in extended format ("YYYY-MM-DD") from
+   * given position of the input, advancing the position past it. Only the
+   * shape of the input is checked, not the values.
+   *
+   * \return A boolean flag indicating whether the input has correct shape
+   */
+  constexpr bool parse_iso_date(
+    std::string_view input,
+    std::size_t& position,
+    int& year,
+    int& month,
+    int& day
+  ) noexcept
+  {
+    if (position > input.length() || input.length() - position < 10)
+    {
+      return false;
+    }
+
+    const auto s = input.substr(position, 10);
+    const unsigned digits[8] =
+    {
+      digit_value(s[0]),
+      digit_value(s[1]),
+      digit_value(s[2]),
+      digit_value(s[3]),
+      digit_value(s[5]),
+      digit_value(s[6]),
+      digit_value(s[8]),
+      digit_value(s[9])
+    };
+
+    if (
+      (s[4] != '-') | (s[7] != '-') |
+      (digits[0] > 9) | (digits[1] > 9) | (digits[2] > 9) | (digits[3] > 9) |
+      (digits[4] > 9) | (digits[5] > 9) | (digits[6] > 9) | (digits[7] > 9)
+    )
+    {
+      return false;
+    }
+    year = static_cast<int>(
+      digits[0] * 1000 + digits[1] * 100 + digits[2] * 10 + digits[3]
+    );
+    month = static_cast<int>(digits[4] * 10 + digits[5]);
+    day = static_cast<int>(digits[6] * 10 + digits[7]);
+    position += 10;
+
+    return true;
+  }
+
+  /**
+   * Parses ISO 8601 time of day in extended format ("hh:mm:ss") from given
+   * position of the input, advancing the position past it. Only the shape
+   * of the input is checked, not the values.
+   *
+   * \return A boolean flag indicating whether the input has correct shape
+   */
+  constexpr bool parse_iso_clock(
+    std::string_view input,
+    std::size_t& position,
+    int& hour,
+    int& minute,
+    int& second
+  ) noexcept
+  {
+    if (position > input.length() || input.length() - position < 8)
+    {
+      return false;
+    }
+
+    const auto s = input.substr(position, 8);
+    const unsigned digits[6] =
+    {
+      digit_value(s[0]),
+      digit_value(s[1]),
+      digit_value(s[3]),
+      digit_value(s[4]),
+      digit_value(s[6]),
+      digit_value(s[7])
+    };
+
+    if (
+      (s[2] != ':') | (s[5] != ':') |
+      (digits[0] > 9) | (digits[1] > 9) | (digits[2] > 9) |
+      (digits[3] > 9) | (digits[4] > 9) | (digits[5] > 9)
+    )
+    {
+      return false;
+    }
+    hour = static_cast<int>(digits[0] * 10 + digits[1]);
+    minute = static_cast<int>(digits[2] * 10 + digits[3]);
+    second = static_cast<int>(digits[4] * 10 + digits[5]);
+    position += 8;
+
+    return true;
+  }
+
+  /**
+   * Parses optional fraction of a second, which is a full stop followed by
+   * one or more digits, from given position of the input, advancing the
+   * position past it. Fractions longer than nine digits are truncated.
+   *
+   * \return A boolean flag indicating whether the input has correct shape
+   */
+  constexpr bool parse_iso_fraction(
+    std::string_view input,
+    std::size_t& position,
+    int& nanosecond
+  ) noexcept
+  {
+    nanosecond = 0;
+    if (position < input.length() && input[position] == '.')
+    {
+      int scale = 100000000;
+
+      if (++position >= input.length() || digit_value(input[position]) > 9)
+      {
+        return false;
+      }
+      while (position < input.length())
+      {
+        const auto value = digit_value(input[position]);
+
+        if (value > 9)
+        {
+          break;
+        }
+        nanosecond += static_cast<int>(value) * scale;
+        scale /= 10;
+        ++position;
+      }
+    }
+
+    return true;
+  }
+
+  /**
+   * Parses ISO 8601 time of day in extended format ("hh:mm:ss"), followed by
+   * optional fraction of a second, from given position of the input,
+   * advancing the position past it. Only the shape of the input is checked,
+   * not the values.
+   *
+   * \return A boolean flag indicating whether the input has correct shape
+   */
+  constexpr bool parse_iso_time(
+    std::string_view input,
+    std::size_t& position,
+    int& hour,
+    int& minute,
+    int& second,
+    int& nanosecond
+  ) noexcept
+  {
+    return parse_iso_clock(input, position, hour, minute, second)
+      && parse_iso_fraction(input, position, nanosecond);
+  }
+
+  /**
+   * Parses ISO 8601 date and time of day in extended format
+   * ("YYYY-MM-DDThh:mm:ss") from given position of the input, advancing the
+   * position past it. Lower case "t" and a space are also accepted in place
+   * of "T". Only the shape of the input is checked, not the values.
+   *
+   * Uses a vectorized kernel when the processor supports it.
+   *
+   * \return A boolean flag indicating whether the input has correct shape
+   */
+  constexpr bool parse_iso_date_time(
+    std::string_view input,
+    std::size_t& position,
+    int& year,
+    int& month,
+    int& day,
+    int& hour,
+    int& minute,
+    int& second
+  ) noexcept
+  {
+    if (position > input.length() || input.length() - position < 19)
+    {
+      return false;
+    }
+
+    const auto separator = input[position + 10];
+
+    if (separator != 'T' && separator != 't' && separator != ' ')
+    {
+      return false;
+    }
+#if defined(PEELO_CHRONO_SIMD_SSSE3)
+    if (!PEELO_CHRONO_IS_CONSTANT_EVALUATED() && simd::has_ssse3)
+    {
+      int fields[6] = {};
+
+      if (!simd::parse_date_time(input.data() + position, fields))
+      {
+        return false;
+      }
+      year = fields[0];
+      month = fields[1];
+      day = fields[2];
+      hour = fields[3];
+      minute = fields[4];
+      second = fields[5];
+      position += 19;
+
+      return true;
+    }
+#endif
+    if (!parse_iso_date(input, position, year, month, day))
+    {
+      return false;
+    }
+    ++position;
+
+    return parse_iso_clock(input, position, hour, minute, second);
+  }
+
+  /**
+   * Parses offset from UTC, which is either "Z" or a sign followed by hours
+   * and optional minutes and seconds, such as "+05:30", "+0530" or "-08",
+   * from given position of the input, advancing the position past it. Only
+   * the shape of the input is checked, not the values.
+   *
+   * \return A boolean flag indicating whether the input has correct shape
+   */
+  constexpr bool parse_offset(
+    std::string_view input,
+    std::size_t& position,
+    bool& negative,
+    int& hours,
+    int& minutes,
+    int& seconds
+  ) noexcept
+  {
+    if (position >= input.length())
+    {
+      return false;
+    }
+
+    const auto sign = input[position++];
+
+    negative = sign == '-';
+    hours = minutes = seconds = 0;
+    if (sign == 'Z' || sign == 'z')
+    {
+      return true;
+    }
+    else if ((sign != '+' && sign != '-')
+             || !parse_digits(input, position, 2, hours))
+    {
+      return false;
+    }
+
+    int* const fields[] = { &minutes, &seconds };
+
+    for (auto field : fields)
+    {
+      auto next = position;
+
+      if (next < input.length() && input[next] == ':')
+      {
+        ++next;
+      }
+      if (!parse_digits(input, next, 2, *field))
+      {
+        *field = 0;
+        break;
+      }
+      position = next;
+    }
+
+    return true;
+  }
+
   /**
    * Thread safe (at least on most platforms) version of `std::localtime`.
    */
@@ -59,7 +467,7 @@ namespace peelo::chrono::utils
     if (!(pointer = std::localtime(&timestamp)))
 #endif
     {
-      throw std::runtime_error("localtime() failed");
+      PEELO_CHRONO_THROW(std::runtime_error("localtime() failed"));
     }
 
 #if !defined(_WIN32) && !defined(__unix__)
@@ -68,4 +476,64 @@ namespace peelo::chrono::utils
     return result;
 #endif
   }
+
+  /**
+   * Same as `localtime()`, but remembers the result of the latest conversion
+   * in each thread, so converting the same second again does not call into
+   * the C library. The cache is keyed on the timestamp alone, so when the
+   * time zone of the process changes, for example with `tzset()`, the
+   * previous result is still returned for the same second.
+   */
+  inline std::tm cached_localtime(const std::time_t& timestamp)
+  {
+    struct entry
+    {
+      bool valid;
+      std::time_t timestamp;
+      std::tm value;
+    };
+    static thread_local entry cache = {};
+
+    if (!cache.valid || cache.timestamp != timestamp)
+    {
+      cache.value = localtime(timestamp);
+      cache.timestamp = timestamp;
+      cache.valid = true;
+    }
+
+    return cache.value;
+  }
+
+  /**
+   * Returns current local time according to given clock, which must measure
+   * time since UNIX epoch like `std::chrono::system_clock` does.
+   */
+  template<class Clock>
+  inline std::tm localtime_now()
+  {
+    const auto seconds = std::chrono::floor<std::chrono::seconds>(
+      Clock::now().time_since_epoch()
+    );
+
+    return cached_localtime(static_cast<std::time_t>(seconds.count()));
+  }
+
+  /**
+   * Returns current local time according to given clock, which must measure
+   * time since UNIX epoch like `std::chrono::system_clock` does.
+   *
+   * \param nanosecond Receives the fraction of the current second
+   */
+  template<class Clock>
+  inline std::tm localtime_now(int& nanosecond)
+  {
+    const auto now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      Clock::now().time_since_epoch()
+    );
+    const auto seconds = std::chrono::floor<std::chrono::seconds>(now);
+
+    nanosecond = static_cast<int>((now - seconds).count());
+
+    return cached_localtime(static_cast<std::time_t>(seconds.count()));
+  }
 }
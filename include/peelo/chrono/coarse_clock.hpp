@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2016-2024, peelo.net
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include <chrono>
+#if defined(__unix__)
+#  include <time.h>
+#endif
+
+namespace peelo::chrono
+{
+  /**
+   * Wall clock which trades precision for speed. Where the platform provides
+   * `CLOCK_REALTIME_COARSE`, the current time is read from the timestamp the
+   * kernel updates on each tick, which is considerably cheaper than reading
+   * the precise realtime clock but only accurate to a few milliseconds.
+   * Elsewhere falls back to `std::chrono::system_clock`.
+   *
+   * Measures time since UNIX epoch, so it can be given to functions such as
+   * `datetime::now()` and `date::today()`.
+   */
+  class coarse_clock
+  {
+  public:
+    using duration = std::chrono::nanoseconds;
+    using rep = duration::rep;
+    using period = duration::period;
+    using time_point = std::chrono::time_point<
+      std::chrono::system_clock,
+      duration
+    >;
+
+    static constexpr bool is_steady = false;
+
+    /**
+     * Returns current time from the coarse realtime clock.
+     */
+    static time_point now() noexcept
+    {
+#if defined(CLOCK_REALTIME_COARSE)
+      ::timespec ts;
+
+      if (!::clock_gettime(CLOCK_REALTIME_COARSE, &ts))
+      {
+        return time_point(
+          std::chrono::seconds(ts.tv_sec) +
+          std::chrono::nanoseconds(ts.tv_nsec)
+        );
+      }
+#endif
+
+      return std::chrono::time_point_cast<duration>(
+        std::chrono::system_clock::now()
+      );
+    }
+  };
+}
@@ -26,15 +26,15 @@
 #pragma once
 
 #include <chrono>
+#include <limits>
 #include <stdexcept>
 
-#if !defined(BUFSIZ)
-#  define BUFSIZ 1024
-#endif
-
 #include <peelo/chrono/_utils.hpp>
 #include <peelo/chrono/duration.hpp>
+#include <peelo/chrono/format_pattern.hpp>
 #include <peelo/chrono/month.hpp>
+#include <peelo/chrono/period.hpp>
+#include <peelo/chrono/result.hpp>
 #include <peelo/chrono/weekday.hpp>
 
 namespace peelo::chrono
@@ -45,6 +45,12 @@ namespace peelo::chrono
   class date
   {
   public:
+    /**
+     * Maximum length of the string produced by `to_string()` and
+     * `to_chars()` without format pattern.
+     */
+    static constexpr std::size_t max_string_length = 18;
+
     /**
      * Constructs a date from given values.
      *
@@ -54,7 +60,7 @@ namespace peelo::chrono
      * \throw std::invalid_argument If given values do not construct a valid
      *                              date
      */
-    explicit date(
+    explicit constexpr date(
       int year = 1900,
       const enum month& month = month::jan,
       int day = 1
@@ -65,10 +71,27 @@ namespace peelo::chrono
     {
       if (!is_valid(year, month, day))
       {
-        throw std::invalid_argument("invalid date value");
+        PEELO_CHRONO_THROW(std::invalid_argument("invalid date value"));
       }
     }
 
+    /**
+     * Constructs a date from given values without validating them.
+     *
+     * \param year  Year of the date
+     * \param month Month of the year
+     * \param day   Day of the month
+     */
+    constexpr date(
+      unchecked_t,
+      int year,
+      const enum month& month,
+      int day
+    ) noexcept
+      : m_year(year)
+      , m_month(month)
+      , m_day(day) {}
+
     /**
      * Copy constructor.
      */
@@ -80,18 +103,47 @@ namespace peelo::chrono
     date(date&&) = default;
 
     /**
-     * Returns current date based on system clock.
+     * Constructs a date from given values without throwing an exception.
+     *
+     * \param year  Year of the date
+     * \param month Month of the year
+     * \param day   Day of the month
+     * \return      Either the date, or an error code describing why given
+     *              values do not construct a valid date
+     */
+    static constexpr result<date> make(
+      int year,
+      const enum month& month,
+      int day
+    ) noexcept
+    {
+      const auto error = validate(year, month, day);
+
+      if (error != errc::ok)
+      {
+        return error;
+      }
+
+      return date(unchecked, year, month, day);
+    }
+
+    /**
+     * Returns current date based on given clock, which defaults to system
+     * clock. The clock must measure time since UNIX epoch, such as
+     * `coarse_clock` does. Local time is only computed again when the second
+     * changes. A change of the time zone of the process, for example with
+     * `tzset()`, is therefore only seen from the next second onwards.
      *
      * \throw std::runtime_error If current date cannot be retrieved from the
      *                           system for some reason
      */
+    template<class Clock = std::chrono::system_clock>
     static date today()
     {
-      const auto now = std::chrono::system_clock::now();
-      const auto ts = std::chrono::system_clock::to_time_t(now);
-      const auto result = utils::localtime(ts);
+      const auto result = utils::localtime_now<Clock>();
 
       return date(
+        unchecked,
         result.tm_year + 1900,
         static_cast<enum month>(result.tm_mon),
         result.tm_mday
@@ -148,20 +200,147 @@ namespace peelo::chrono
     }
 
     /**
-     * Constructs date value from UNIX timestamp.
+     * Constructs date value from UNIX timestamp, which is converted into
+     * local time of the process. Equivalent to `from_local_timestamp()`.
      */
     static date timestamp(long timestamp)
+    {
+      return from_local_timestamp(timestamp);
+    }
+
+    /**
+     * Constructs date value from UNIX timestamp, which is interpreted as UTC.
+     * Unlike `from_local_timestamp()`, does not call into the C library and
+     * does not depend on the time zone of the process.
+     *
+     * \param timestamp Number of seconds since UNIX epoch
+     * \throw std::out_of_range If the year of the resulting date cannot be
+     *                          represented
+     */
+    static constexpr date from_utc_timestamp(std::int64_t timestamp)
+    {
+      constexpr auto min_days = utils::days_from_civil(
+        std::numeric_limits<int>::min(),
+        1,
+        1
+      );
+      constexpr auto max_days = utils::days_from_civil(
+        std::numeric_limits<int>::max(),
+        12,
+        31
+      );
+      const auto quotient = timestamp / duration::seconds_per_day;
+      const auto days = timestamp % duration::seconds_per_day < 0
+        ? quotient - 1
+        : quotient;
+
+      if (days < min_days || days > max_days)
+      {
+        PEELO_CHRONO_THROW(std::out_of_range("timestamp out of range"));
+      }
+
+      return epoch_day(days);
+    }
+
+    /**
+     * Constructs date value from UNIX timestamp, which is converted into
+     * local time of the process with localtime().
+     *
+     * \param timestamp Number of seconds since UNIX epoch
+     * \throw std::runtime_error If the timestamp cannot be converted into
+     *                           local time
+     */
+    static date from_local_timestamp(std::int64_t timestamp)
     {
       const auto ts = static_cast<std::time_t>(timestamp);
       const auto result = utils::localtime(ts);
 
       return date(
+        unchecked,
         result.tm_year + 1900,
         static_cast<enum month>(result.tm_mon),
         result.tm_mday
       );
     }
 
+    /**
+     * Constructs date value from number of days since UNIX epoch
+     * (1970-01-01). The resulting year must fit into `int`, which is not
+     * checked.
+     *
+     * \param days Number of days since UNIX epoch
+     */
+    static constexpr date epoch_day(std::int64_t days) noexcept
+    {
+      const auto result = utils::civil_from_days(days);
+
+      return date(
+        unchecked,
+        static_cast<int>(result.year),
+        static_cast<enum month>(result.month - 1),
+        result.day
+      );
+    }
+
+    /**
+     * Constructs date value from system clock time point with precision of
+     * one day.
+     *
+     * \param days System clock time point to convert
+     */
+    static constexpr date from_sys_days(const sys_days& days) noexcept
+    {
+      return epoch_day(days.time_since_epoch().count());
+    }
+
+#if defined(__cpp_lib_chrono) && __cpp_lib_chrono >= 201907L
+    /**
+     * Constructs date value from standard library calendar date without
+     * throwing an exception.
+     *
+     * \param ymd Standard library calendar date to convert
+     * \return    Either the date, or an error code describing why given
+     *            value is not a valid date
+     */
+    static constexpr result<date> make(
+      const std::chrono::year_month_day& ymd
+    ) noexcept
+    {
+      return make(
+        static_cast<int>(ymd.year()),
+        static_cast<enum month>(static_cast<unsigned>(ymd.month()) - 1),
+        static_cast<int>(static_cast<unsigned>(ymd.day()))
+      );
+    }
+#endif
+
+    /**
+     * Validates given date values.
+     *
+     * \param year  Year of the date
+     * \param month Month of the year
+     * \param day   Day of the month
+     * \return      `errc::ok` if given values construct a valid date, or an
+     *              error code describing the first invalid value
+     */
+    static constexpr errc validate(
+      int year,
+      const enum month& month,
+      int day
+    ) noexcept
+    {
+      if (month < month::jan || month > month::dec)
+      {
+        return errc::invalid_month;
+      }
+      else if (day < 1 || day > days_in_month(month, is_leap_year(year)))
+      {
+        return errc::invalid_day;
+      }
+
+      return errc::ok;
+    }
+
     /**
      * Tests whether given values are a valid date.
      *
@@ -171,15 +350,71 @@ namespace peelo::chrono
      * \return      A boolean flag indicating whether an valid date can be
      *              constructed from given values
      */
-    static inline bool is_valid(int year, const enum month& month, int day)
+    static constexpr bool is_valid(
+      int year,
+      const enum month& month,
+      int day
+    ) noexcept
+    {
+      return validate(year, month, day) == errc::ok;
+    }
+
+    /**
+     * Parses ISO 8601 calendar date in extended format, such as
+     * "2024-07-04".
+     *
+     * \param input Text to parse
+     * \return      Either the parsed date, or an error code describing why
+     *              the input could not be parsed
+     */
+    static constexpr result<date> parse(std::string_view input) noexcept
+    {
+      std::size_t position = 0;
+      const auto value = parse(input, position);
+
+      if (value && position != input.length())
+      {
+        return errc::invalid_format;
+      }
+
+      return value;
+    }
+
+    /**
+     * Parses ISO 8601 calendar date in extended format from given position
+     * of the input, advancing the position past the date. Any text after
+     * the date is left unparsed.
+     *
+     * \param input    Text to parse
+     * \param position Position where the date begins
+     * \return         Either the parsed date, or an error code describing
+     *                 why the input could not be parsed
+     */
+    static constexpr result<date> parse(
+      std::string_view input,
+      std::size_t& position
+    ) noexcept
     {
-      return day > 0 && day <= days_in_month(month, is_leap_year(year));
+      int year = 0;
+      int month = 0;
+      int day = 0;
+
+      if (!utils::parse_iso_date(input, position, year, month, day))
+      {
+        return errc::invalid_format;
+      }
+      else if (month < 1 || month > 12)
+      {
+        return errc::invalid_month;
+      }
+
+      return make(year, static_cast<enum month>(month - 1), day);
     }
 
     /**
      * Returns year of the date.
      */
-    inline int year() const
+    constexpr int year() const noexcept
     {
       return m_year;
     }
@@ -187,7 +422,7 @@ namespace peelo::chrono
     /**
      * Returns month of the year.
      */
-    inline const enum month& month() const
+    constexpr const enum month& month() const noexcept
     {
       return m_month;
     }
@@ -195,38 +430,24 @@ namespace peelo::chrono
     /**
      * Returns day of the month (from 1 to 31) of the date.
      */
-    inline int day() const
+    constexpr int day() const noexcept
     {
       return m_day;
     }
 
     /**
      * Returns week of day for this date.
-     *
-     * \throw runtime_error If day of the week cannot be determined for some
-     *                      system specific reason
      */
-    weekday day_of_week() const
+    constexpr weekday day_of_week() const noexcept
     {
-      auto tm = make_tm(*this);
-
-      if (std::mktime(&tm) == -1)
-      {
-        throw std::runtime_error("mktime() failed");
-      }
-      else if (tm.tm_wday < 0 && tm.tm_wday > 6)
-      {
-        throw std::runtime_error("unable to determine day of week");
-      }
-
-      return static_cast<enum weekday>(tm.tm_wday);
+      return static_cast<enum weekday>(utils::weekday_from_days(epoch_day()));
     }
 
     /**
      * Returns the day of the year (from 1 to 365 or 366 on leap years) for
      * this date.
      */
-    int day_of_year() const
+    constexpr int day_of_year() const noexcept
     {
       const bool leap_year = is_leap_year();
       int result = 0;
@@ -242,7 +463,7 @@ namespace peelo::chrono
     /**
      * Returns the number of days in the month (28-31) for this date.
      */
-    inline int days_in_month() const
+    constexpr int days_in_month() const noexcept
     {
       return days_in_month(m_month, is_leap_year());
     }
@@ -253,7 +474,10 @@ namespace peelo::chrono
      * \param month     Month to retrieve number of days for
      * \param leap_year Whether the year is leap year or not
      */
-    static int days_in_month(const enum month& month, bool leap_year)
+    static constexpr int days_in_month(
+      const enum month& month,
+      bool leap_year
+    ) noexcept
     {
       switch (month)
       {
@@ -281,7 +505,7 @@ namespace peelo::chrono
     /**
      * Returns the number of days in the year (365 or 366) for this date.
      */
-    inline int days_in_year() const
+    constexpr int days_in_year() const noexcept
     {
       return days_in_year(m_year);
     }
@@ -291,7 +515,7 @@ namespace peelo::chrono
      *
      * \param year Year to retrieve number of days for
      */
-    static inline int days_in_year(int year)
+    static constexpr int days_in_year(int year) noexcept
     {
       return is_leap_year(year) ? 366 : 365;
     }
@@ -300,7 +524,7 @@ namespace peelo::chrono
      * Returns <code>true</code> if the year represented by the date is a leap
      * year.
      */
-    inline bool is_leap_year() const
+    constexpr bool is_leap_year() const noexcept
     {
       return is_leap_year(m_year);
     }
@@ -310,66 +534,94 @@ namespace peelo::chrono
      *
      * \param year Year to test for leap year
      */
-    static inline bool is_leap_year(int year)
+    static constexpr bool is_leap_year(int year) noexcept
     {
       return (year % 4 == 0 && year % 100 != 0) || (year % 400 == 0);
     }
 
     /**
-     * Calculates UNIX timestamp from date.
+     * Returns number of days since UNIX epoch (1970-01-01) for this date.
      */
-    std::int64_t timestamp() const
+    constexpr std::int64_t epoch_day() const noexcept
     {
-      static const int seconds_per_day = 86400;
-      static const int days_before_month[12] =
-      {
-        0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334
-      };
-      // Compute days in a year.
-      auto days = (
-        (static_cast<std::int64_t>(m_day) - 1) +
-        (days_before_month[static_cast<int>(m_month) - 1])
+      return utils::days_from_civil(
+        m_year,
+        static_cast<int>(m_month) + 1,
+        m_day
       );
+    }
 
-      // Leap year adjustment.
-      if (m_month > month::jan && is_leap_year())
-      {
-        ++days;
-      }
+    /**
+     * Converts the date into system clock time point with precision of one
+     * day.
+     */
+    constexpr sys_days to_sys_days() const noexcept
+    {
+      return sys_days(sys_days::duration(epoch_day()));
+    }
 
-      // Compute days from other years.
-      if (m_year > 1970)
-      {
-        for (int year = 1970; year < m_year; ++year)
-        {
-          days += days_in_year(year);
-        }
-      }
-      else if (m_year < 1970)
-      {
-        for (int year = 1969; year >= m_year; --year)
-        {
-          days -= days_in_year(year);
-        }
-      }
+#if defined(__cpp_lib_chrono) && __cpp_lib_chrono >= 201907L
+    /**
+     * Converts the date into standard library calendar date.
+     */
+    constexpr std::chrono::year_month_day to_year_month_day() const noexcept
+    {
+      return std::chrono::year_month_day(
+        std::chrono::year(m_year),
+        std::chrono::month(static_cast<unsigned>(m_month) + 1),
+        std::chrono::day(static_cast<unsigned>(m_day))
+      );
+    }
+#endif
+
+    /**
+     * Calculates UNIX timestamp from midnight of the date, which is
+     * interpreted as UTC.
+     */
+    constexpr std::int64_t timestamp() const noexcept
+    {
+      return to_utc_timestamp();
+    }
 
-      return days * seconds_per_day;
+    /**
+     * Calculates UNIX timestamp from midnight of the date, which is
+     * interpreted as UTC. Does not depend on the time zone of the process.
+     */
+    constexpr std::int64_t to_utc_timestamp() const noexcept
+    {
+      return epoch_day() * duration::seconds_per_day;
     }
 
     /**
-     * Uses strftime() function to format the date into a string.
+     * Formats the date into a string using given strftime() style format
+     * specification. See `format_pattern` for supported conversion
+     * specifiers.
      */
     std::string format(const std::string& format) const
     {
-      char buffer[BUFSIZ];
-      auto tm = make_tm(*this);
+      return this->format(format_pattern(format));
+    }
 
-      if (std::strftime(buffer, BUFSIZ, format.c_str(), &tm) == 0)
-      {
-        throw std::runtime_error("strftime() failed");
-      }
+    /**
+     * Formats the date into a string using given compiled format pattern.
+     */
+    std::string format(const format_pattern& pattern) const
+    {
+      return pattern.render(format_fields());
+    }
+
+    /**
+     * Returns the date broken down into fields used by `format_pattern`.
+     */
+    format_pattern::fields format_fields() const noexcept
+    {
+      format_pattern::fields fields;
+
+      fields.year = m_year;
+      fields.month = static_cast<int>(m_month) + 1;
+      fields.day = m_day;
 
-      return buffer;
+      return fields;
     }
 
     /**
@@ -377,9 +629,13 @@ namespace peelo::chrono
      *
      * \param that Other date to copy values from
      */
-    inline date& assign(const date& that)
+    constexpr date& assign(const date& that) noexcept
     {
-      return assign(that.m_year, that.m_month, that.m_day);
+      m_year = that.m_year;
+      m_month = that.m_month;
+      m_day = that.m_day;
+
+      return *this;
     }
 
     /**
@@ -391,11 +647,11 @@ namespace peelo::chrono
      * \throw std::invalid_argument If given values do not construct a valid
      *                              date
      */
-    date& assign(int year, const enum month& month, int day)
+    constexpr date& assign(int year, const enum month& month, int day)
     {
       if (!is_valid(year, month, day))
       {
-        throw std::invalid_argument("invalid date value");
+        PEELO_CHRONO_THROW(std::invalid_argument("invalid date value"));
       }
       m_year = year;
       m_month = month;
@@ -420,7 +676,7 @@ namespace peelo::chrono
      * \param that Another date to compare this one with
      * \return     A boolean flag indicating whether the dates are equal or not
      */
-    inline bool equals(const date& that) const
+    constexpr bool equals(const date& that) const noexcept
     {
       return equals(that.m_year, that.m_month, that.m_day);
     }
@@ -434,7 +690,11 @@ namespace peelo::chrono
      * \return      A boolean flag indicating whether this date has given
      *              values or not
      */
-    inline bool equals(int year, const enum month& month, int day) const
+    constexpr bool equals(
+      int year,
+      const enum month& month,
+      int day
+    ) const noexcept
     {
       return m_year == year && m_month == month && m_day == day;
     }
@@ -442,7 +702,7 @@ namespace peelo::chrono
     /**
      * Equality testing operator.
      */
-    inline bool operator==(const date& that) const
+    constexpr bool operator==(const date& that) const noexcept
     {
       return equals(that);
     }
@@ -450,7 +710,7 @@ namespace peelo::chrono
     /**
      * Non-equality testing operator.
      */
-    inline bool operator!=(const date& that) const
+    constexpr bool operator!=(const date& that) const noexcept
     {
       return !equals(that);
     }
@@ -461,7 +721,7 @@ namespace peelo::chrono
      * \param that Other date to compare this one against
      * \return     Integer value indicating comparison result
      */
-    inline int compare(const date& that) const
+    constexpr int compare(const date& that) const noexcept
     {
       return compare(that.m_year, that.m_month, that.m_day);
     }
@@ -474,7 +734,11 @@ namespace peelo::chrono
      * \param day   Day of the month
      * \return      Integer value indicating comparison result
      */
-    int compare(int year, const enum month& month, int day) const
+    constexpr int compare(
+      int year,
+      const enum month& month,
+      int day
+    ) const noexcept
     {
       if (m_year != year)
       {
@@ -495,7 +759,7 @@ namespace peelo::chrono
     /**
      * Comparison operator.
      */
-    inline bool operator<(const date& that) const
+    constexpr bool operator<(const date& that) const noexcept
     {
       return compare(that) < 0;
     }
@@ -503,7 +767,7 @@ namespace peelo::chrono
     /**
      * Comparison operator.
      */
-    inline bool operator>(const date& that) const
+    constexpr bool operator>(const date& that) const noexcept
     {
       return compare(that) > 0;
     }
@@ -511,7 +775,7 @@ namespace peelo::chrono
     /**
      * Comparison operator.
      */
-    inline bool operator<=(const date& that) const
+    constexpr bool operator<=(const date& that) const noexcept
     {
       return compare(that) <= 0;
     }
@@ -519,7 +783,7 @@ namespace peelo::chrono
     /**
      * Comparison operator.
      */
-    inline bool operator>=(const date& that) const
+    constexpr bool operator>=(const date& that) const noexcept
     {
       return compare(that) >= 0;
     }
@@ -527,7 +791,7 @@ namespace peelo::chrono
     /**
      * Increments date by one day.
      */
-    date& operator++()
+    constexpr date& operator++() noexcept
     {
       if (m_day == days_in_month())
       {
@@ -549,7 +813,7 @@ namespace peelo::chrono
     /**
      * Increments date by one day.
      */
-    date operator++(int)
+    constexpr date operator++(int) noexcept
     {
       const date return_value = date(*this);
 
@@ -573,7 +837,7 @@ namespace peelo::chrono
     /**
      * Decrements date by one day.
      */
-    date& operator--()
+    constexpr date& operator--() noexcept
     {
       if (m_day > 1)
       {
@@ -585,7 +849,7 @@ namespace peelo::chrono
         m_month = month::dec;
         m_day = 31;
       } else {
-        m_day = days_in_month(--m_month, m_year);
+        m_day = days_in_month(--m_month, is_leap_year());
       }
 
       return *this;
@@ -594,7 +858,7 @@ namespace peelo::chrono
     /**
      * Decrements date by one day.
      */
-    date operator--(int)
+    constexpr date operator--(int) noexcept
     {
       const date return_value = date(*this);
 
@@ -608,139 +872,197 @@ namespace peelo::chrono
         m_month = month::dec;
         m_day = 31;
       } else {
-        m_day = days_in_month(--m_month, m_year);
+        m_day = days_in_month(--m_month, is_leap_year());
       }
 
       return return_value;
     }
 
     /**
-     * Adds given number of days to the date and returns result.
+     * Returns a copy of the date with given number of months added to it.
+     *
+     * \param months Number of months to add, may be negative
+     * \param policy What to do when the day does not exist in the resulting
+     *               month
+     * \throw std::invalid_argument If the day does not exist in the resulting
+     *                              month and policy is
+     *                              `overflow_policy::error`
+     * \throw std::out_of_range     If the resulting year cannot be
+     *                              represented
      */
-    date operator+(int days) const
+    constexpr date add_months(
+      std::int64_t months,
+      overflow_policy policy = overflow_policy::clamp
+    ) const
     {
-      auto tm = make_tm(*this);
+      constexpr std::int64_t min_year = std::numeric_limits<int>::min();
+      constexpr std::int64_t max_year = std::numeric_limits<int>::max();
 
-      if (days > 0)
+      if (months < (min_year - max_year) * 12 ||
+          months > (max_year - min_year) * 12)
       {
-        tm.tm_mday += days;
-      } else {
-        tm.tm_mday -= -days;
+        PEELO_CHRONO_THROW(std::out_of_range("date out of range"));
       }
-      if (std::mktime(&tm) == -1 || tm.tm_mon < 0 || tm.tm_mon > 11)
+
+      const auto total = static_cast<std::int64_t>(m_year) * 12
+        + static_cast<int>(m_month)
+        + months;
+      const auto total_years = total >= 0 ? total / 12 : (total - 11) / 12;
+
+      if (total_years < min_year || total_years > max_year)
       {
-        throw std::runtime_error("mktime() failed");
+        PEELO_CHRONO_THROW(std::out_of_range("date out of range"));
       }
 
-      return date(
-        tm.tm_year + 1900,
-        static_cast<enum month>(tm.tm_mon),
-        tm.tm_mday
-      );
+      const auto year = static_cast<int>(total_years);
+      const auto month = static_cast<enum month>(total - total_years * 12);
+      const auto last_day = days_in_month(month, is_leap_year(year));
+
+      if (m_day <= last_day)
+      {
+        return date(unchecked, year, month, m_day);
+      }
+      else if (policy == overflow_policy::clamp)
+      {
+        return date(unchecked, year, month, last_day);
+      }
+      else if (policy == overflow_policy::overflow)
+      {
+        return date(unchecked, year, month, last_day) + (m_day - last_day);
+      }
+      PEELO_CHRONO_THROW(std::invalid_argument("invalid date value"));
     }
 
     /**
-     * Substracts given number of days from the date and returns result.
+     * Returns a copy of the date with given number of years added to it.
+     *
+     * \param years  Number of years to add, may be negative
+     * \param policy What to do when the date is February 29th and the
+     *               resulting year is not a leap year
+     * \throw std::invalid_argument If the day does not exist in the resulting
+     *                              year and policy is `overflow_policy::error`
+     * \throw std::out_of_range     If the resulting year cannot be
+     *                              represented
      */
-    date operator-(int days) const
+    constexpr date add_years(
+      std::int64_t years,
+      overflow_policy policy = overflow_policy::clamp
+    ) const
     {
-      auto tm = make_tm(*this);
+      constexpr std::int64_t max_years = std::numeric_limits<std::int64_t>
+        ::max() / 12;
 
-      if (days > 0)
+      if (years < -max_years || years > max_years)
       {
-        tm.tm_mday -= days;
-      } else {
-        tm.tm_mday += -days;
-      }
-      if (std::mktime(&tm) == -1 || tm.tm_mon < 0 || tm.tm_mon > 11)
-      {
-        throw std::runtime_error("mktime() failed");
+        PEELO_CHRONO_THROW(std::out_of_range("date out of range"));
       }
 
-      return date(
-        tm.tm_year + 1900,
-        static_cast<enum month>(tm.tm_mon),
-        tm.tm_mday
-      );
+      return add_months(years * 12, policy);
     }
 
     /**
-     * Adds given number of days to the date.
+     * Returns a copy of the date with given period added to it. Years and
+     * months are added first, followed by the days.
+     *
+     * \param period Period to add
+     * \param policy What to do when the day does not exist in the month
+     *               resulting from adding years and months
+     * \throw std::invalid_argument If the day does not exist in the resulting
+     *                              month and policy is
+     *                              `overflow_policy::error`
+     * \throw std::out_of_range     If the resulting year cannot be
+     *                              represented
      */
-    date& operator+=(int days)
+    constexpr date add(
+      const class period& period,
+      overflow_policy policy = overflow_policy::clamp
+    ) const
     {
-      auto tm = make_tm(*this);
-
-      if (days > 0)
-      {
-        tm.tm_mday += days;
-      } else {
-        tm.tm_mday -= -days;
-      }
-      if (std::mktime(&tm) == -1 || tm.tm_mon < 0 || tm.tm_mon > 11)
-      {
-        throw std::runtime_error("mktime() failed");
-      }
+      return add_months(period.total_months(), policy) + period.days();
+    }
 
-      return assign(
-        tm.tm_year - 1900,
-        static_cast<enum month>(tm.tm_mon),
-        tm.tm_mday
-      );
+    /**
+     * Adds given number of days to the date and returns result.
+     */
+    constexpr date operator+(int days) const noexcept
+    {
+      return epoch_day(epoch_day() + days);
     }
 
     /**
-     * Substracts given number of days from the date.
+     * Substracts given number of days from the date and returns result.
      */
-    date& operator-=(int days)
+    constexpr date operator-(int days) const noexcept
     {
-      auto tm = make_tm(*this);
+      return epoch_day(epoch_day() - days);
+    }
 
-      if (days > 0)
-      {
-        tm.tm_mday -= days;
-      } else {
-        tm.tm_mday += -days;
-      }
-      if (std::mktime(&tm) == -1 || tm.tm_mon < 0 || tm.tm_mon > 11)
-      {
-        throw std::runtime_error("mktime() failed");
-      }
+    /**
+     * Adds given number of days to the date.
+     */
+    constexpr date& operator+=(int days) noexcept
+    {
+      return assign(epoch_day(epoch_day() + days));
+    }
 
-      return assign(
-        tm.tm_year - 1900,
-        static_cast<enum month>(tm.tm_mon),
-        tm.tm_mday
-      );
+    /**
+     * Substracts given number of days from the date.
+     */
+    constexpr date& operator-=(int days) noexcept
+    {
+      return assign(epoch_day(epoch_day() - days));
     }
 
     /**
      * Returns the difference between two dates.
      */
-    duration operator-(const date& that) const
+    constexpr duration operator-(const date& that) const noexcept
     {
-      auto tm1 = make_tm(*this);
-      auto tm2 = make_tm(that);
-      const auto time1 = std::mktime(&tm1);
-      const auto time2 = std::mktime(&tm2);
-      const auto difference = std::difftime(time1, time2);
+      return duration::of_days(epoch_day() - that.epoch_day());
+    }
 
-      return duration(difference);
+    /**
+     * Adds given period to the date and returns result, clamping the day to
+     * the end of the month when necessary.
+     *
+     * \throw std::out_of_range If the resulting year cannot be represented
+     */
+    constexpr date operator+(const class period& period) const
+    {
+      return add(period, overflow_policy::clamp);
     }
 
-  private:
-    static std::tm make_tm(const class date& date)
+    /**
+     * Substracts given period from the date and returns result, clamping the
+     * day to the end of the month when necessary.
+     *
+     * \throw std::out_of_range If the resulting year cannot be represented
+     */
+    constexpr date operator-(const class period& period) const
     {
-      std::tm tm = {0};
+      return add(-period, overflow_policy::clamp);
+    }
 
-      tm.tm_year = date.year() - 1900;
-      tm.tm_mon = static_cast<int>(date.month());
-      tm.tm_mday = date.day();
-      tm.tm_hour = 0;
-      tm.tm_min = 0;
-      tm.tm_sec = 0;
+    /**
+     * Adds given period to the date, clamping the day to the end of the month
+     * when necessary.
+     *
+     * \throw std::out_of_range If the resulting year cannot be represented
+     */
+    constexpr date& operator+=(const class period& period)
+    {
+      return assign(add(period, overflow_policy::clamp));
+    }
 
-      return tm;
+    /**
+     * Substracts given period from the date, clamping the day to the end of
+     * the month when necessary.
+     *
+     * \throw std::out_of_range If the resulting year cannot be represented
+     */
+    constexpr date& operator-=(const class period& period)
+    {
+      return assign(add(-period, overflow_policy::clamp));
     }
 
   private:
@@ -752,12 +1074,53 @@ namespace peelo::chrono
     int m_day;
   };
 
+  /**
+   * Parses ISO 8601 calendar date from character range `[first, last)`, as
+   * `date::parse()` does. Any text after the date is left unparsed. On failure
+   * given value is not modified.
+   *
+   * \return Pointer one past the last character parsed, or `first` and
+   *         `std::errc::invalid_argument` if the input is malformed or
+   *         `std::errc::result_out_of_range` if the values are out of range
+   */
+  constexpr std::from_chars_result from_chars(
+    const char* first,
+    const char* last,
+    class date& date
+  ) noexcept
+  {
+    return utils::from_chars(first, last, date);
+  }
+
+  /**
+   * Writes textual presentation of the date in the format used by
+   * `to_string()` into character range `[first, last)`.
+   *
+   * \return Pointer one past the last character written, or `last` and
+   *         `std::errc::value_too_large` if the range is too small
+   */
+  inline std::to_chars_result to_chars(
+    char* first,
+    char* last,
+    const class date& date
+  )
+  {
+    static const format_pattern pattern("%d %b %Y");
+
+    return pattern.to_chars(first, last, date.format_fields());
+  }
+
   /**
    * Returns textual presentation of the date into the stream in RFC 2822
    * compliant format.
    */
   inline std::string to_string(const class date& date)
   {
-    return date.format("%d %b %Y");
+    char buffer[date::max_string_length];
+
+    return std::string(
+      buffer,
+      to_chars(buffer, buffer + sizeof(buffer), date).ptr
+    );
   }
 }
@@ -41,6 +41,12 @@ namespace peelo::chrono
      */
     static constexpr const char* format_rfc2822 = "%a, %d %b %Y %T %z";
 
+    /**
+     * Maximum length of the string produced by `to_string()` and
+     * `to_chars()` without format pattern.
+     */
+    static constexpr std::size_t max_string_length = 38;
+
     /**
      * Constructs datetime from given values.
      *
@@ -50,19 +56,45 @@ namespace peelo::chrono
      * \param hour   Hour of the date
      * \param minute Minute of the hour
      * \param second Second of the minute
+     * \param nanosecond Nanosecond of the second
      * \throw std::invalid_argument If given values do not construct a valid
      *                              date and time
      */
-    explicit datetime(
+    explicit constexpr datetime(
       int year = 1900,
       const enum month& month = month::jan,
       int day = 1,
       int hour = 0,
       int minute = 0,
-      int second = 0
+      int second = 0,
+      int nanosecond = 0
     )
       : m_date(year, month, day)
-      , m_time(hour, minute, second) {}
+      , m_time(hour, minute, second, nanosecond) {}
+
+    /**
+     * Constructs datetime from given values without validating them.
+     *
+     * \param year   Year of the date
+     * \param month  Month of the year
+     * \param day    Day of the month
+     * \param hour   Hour of the date
+     * \param minute Minute of the hour
+     * \param second Second of the minute
+     * \param nanosecond Nanosecond of the second
+     */
+    constexpr datetime(
+      unchecked_t,
+      int year,
+      const enum month& month,
+      int day,
+      int hour,
+      int minute,
+      int second,
+      int nanosecond = 0
+    ) noexcept
+      : m_date(unchecked, year, month, day)
+      , m_time(unchecked, hour, minute, second, nanosecond) {}
 
     /**
      * Copy constructor.
@@ -77,41 +109,157 @@ namespace peelo::chrono
     /**
      * Constructs datetime from given date and time.
      */
-    datetime(const class date& date, const class time& time)
+    constexpr datetime(
+      const class date& date,
+      const class time& time
+    ) noexcept
       : m_date(date)
       , m_time(time) {}
 
     /**
-     * Returns current date and time based on system clock.
+     * Constructs datetime from given values without throwing an exception.
+     *
+     * \param year   Year of the date
+     * \param month  Month of the year
+     * \param day    Day of the month
+     * \param hour   Hour of the date
+     * \param minute Minute of the hour
+     * \param second Second of the minute
+     * \param nanosecond Nanosecond of the second
+     * \return       Either the date and time, or an error code describing why
+     *               given values do not construct a valid date and time
+     */
+    static constexpr result<datetime> make(
+      int year,
+      const enum month& month,
+      int day,
+      int hour,
+      int minute,
+      int second,
+      int nanosecond = 0
+    ) noexcept
+    {
+      const auto error = validate(
+        year,
+        month,
+        day,
+        hour,
+        minute,
+        second,
+        nanosecond
+      );
+
+      if (error != errc::ok)
+      {
+        return error;
+      }
+
+      return datetime(
+        unchecked,
+        year,
+        month,
+        day,
+        hour,
+        minute,
+        second,
+        nanosecond
+      );
+    }
+
+    /**
+     * Returns current date and time based on given clock, which defaults to
+     * system clock. The clock must measure time since UNIX epoch, such as
+     * `coarse_clock` does. Local time is only computed again when the second
+     * changes. A change of the time zone of the process, for example with
+     * `tzset()`, is therefore only seen from the next second onwards.
      *
      * \throw std::runtime_error If current date and time cannot be extracted
      *                           from the system for reason
      */
+    template<class Clock = std::chrono::system_clock>
     static datetime now()
     {
-      const auto now = std::chrono::system_clock::now();
-      const auto ts = std::chrono::system_clock::to_time_t(now);
-      const auto result = utils::localtime(ts);
+      int nanosecond;
+      const auto result = utils::localtime_now<Clock>(nanosecond);
 
       return datetime(
+        unchecked,
         result.tm_year + 1900,
         static_cast<enum month>(result.tm_mon),
         result.tm_mday,
         result.tm_hour,
         result.tm_min,
-        result.tm_sec
+        result.tm_sec,
+        nanosecond
       );
     }
 
     /**
-     * Constructs date and time from UNIX timestamp.
+     * Constructs date and time from system clock time point, which is
+     * interpreted as UTC. Values more precise than one nanosecond are
+     * truncated.
+     *
+     * \param time_point System clock time point to convert
+     */
+    template<class Duration>
+    static constexpr datetime from_sys_time(
+      const sys_time<Duration>& time_point
+    ) noexcept
+    {
+      const auto since_epoch = time_point.time_since_epoch();
+      const auto days = std::chrono::floor<sys_days::duration>(since_epoch);
+
+      return datetime(
+        date::from_sys_days(sys_days(days)),
+        time::nanosecond_of_day(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(
+            since_epoch - days
+          ).count()
+        )
+      );
+    }
+
+    /**
+     * Constructs date and time from UNIX timestamp, which is converted into
+     * local time of the process. Equivalent to `from_local_timestamp()`.
      */
     static datetime timestamp(long timestamp)
     {
-      auto ts = static_cast<std::time_t>(timestamp);
+      return from_local_timestamp(timestamp);
+    }
+
+    /**
+     * Constructs date and time from UNIX timestamp, which is interpreted as
+     * UTC. Unlike `from_local_timestamp()`, does not call into the C library
+     * and does not depend on the time zone of the process.
+     *
+     * \param timestamp Number of seconds since UNIX epoch
+     * \throw std::out_of_range If the year of the resulting date cannot be
+     *                          represented
+     */
+    static constexpr datetime from_utc_timestamp(std::int64_t timestamp)
+    {
+      return datetime(
+        date::from_utc_timestamp(timestamp),
+        time::second_of_day(timestamp)
+      );
+    }
+
+    /**
+     * Constructs date and time from UNIX timestamp, which is converted into
+     * local time of the process with localtime().
+     *
+     * \param timestamp Number of seconds since UNIX epoch
+     * \throw std::runtime_error If the timestamp cannot be converted into
+     *                           local time
+     */
+    static datetime from_local_timestamp(std::int64_t timestamp)
+    {
+      const auto ts = static_cast<std::time_t>(timestamp);
       const auto result = utils::localtime(ts);
 
       return datetime(
+        unchecked,
         result.tm_year + 1900,
         static_cast<enum month>(result.tm_mon),
         result.tm_mday,
@@ -121,6 +269,39 @@ namespace peelo::chrono
       );
     }
 
+    /**
+     * Validates given date and time values.
+     *
+     * \param year   Year of the date
+     * \param month  Month of the year
+     * \param day    Day of the month
+     * \param hour   Hour of the day
+     * \param minute Minute of the hour
+     * \param second Second of the hour
+     * \param nanosecond Nanosecond of the second
+     * \return       `errc::ok` if given values construct a valid date and
+     *               time, or an error code describing the first invalid value
+     */
+    static constexpr errc validate(
+      int year,
+      const enum month& month,
+      int day,
+      int hour,
+      int minute,
+      int second,
+      int nanosecond = 0
+    ) noexcept
+    {
+      const auto error = date::validate(year, month, day);
+
+      if (error != errc::ok)
+      {
+        return error;
+      }
+
+      return time::validate(hour, minute, second, nanosecond);
+    }
+
     /**
      * Tests whether given values are a valid date and time.
      *
@@ -130,26 +311,103 @@ namespace peelo::chrono
      * \param hour   Hour of the day
      * \param minute Minute of the hour
      * \param second Second of the hour
+     * \param nanosecond Nanosecond of the second
      * \return       A boolean flag indicating whether valid date and time can
      *               be constructed from given values
      */
-    static inline bool is_valid(
+    static constexpr bool is_valid(
       int year,
       const enum month& month,
       int day,
       int hour,
       int minute,
-      int second
-    )
+      int second,
+      int nanosecond = 0
+    ) noexcept
     {
       return date::is_valid(year, month, day)
-        && time::is_valid(hour, minute, second);
+        && time::is_valid(hour, minute, second, nanosecond);
+    }
+
+    /**
+     * Parses ISO 8601 date and time in extended format, such as
+     * "2024-07-04T12:30:00.25". Lower case "t" and a space are also accepted
+     * in place of "T". Fractions of a second longer than nine digits are
+     * truncated.
+     *
+     * \param input Text to parse
+     * \return      Either the parsed date and time, or an error code
+     *              describing why the input could not be parsed
+     */
+    static constexpr result<datetime> parse(std::string_view input) noexcept
+    {
+      std::size_t position = 0;
+      const auto value = parse(input, position);
+
+      if (value && position != input.length())
+      {
+        return errc::invalid_format;
+      }
+
+      return value;
+    }
+
+    /**
+     * Parses ISO 8601 date and time in extended format from given position
+     * of the input, advancing the position past the date and time. Any text
+     * after the time, such as an offset from UTC, is left unparsed.
+     *
+     * \param input    Text to parse
+     * \param position Position where the date and time begins
+     * \return         Either the parsed date and time, or an error code
+     *                 describing why the input could not be parsed
+     */
+    static constexpr result<datetime> parse(
+      std::string_view input,
+      std::size_t& position
+    ) noexcept
+    {
+      int year = 0;
+      int month = 0;
+      int day = 0;
+      int hour = 0;
+      int minute = 0;
+      int second = 0;
+      int nanosecond = 0;
+
+      if (!utils::parse_iso_date_time(
+        input,
+        position,
+        year,
+        month,
+        day,
+        hour,
+        minute,
+        second
+      ) || !utils::parse_iso_fraction(input, position, nanosecond))
+      {
+        return errc::invalid_format;
+      }
+      else if (month < 1 || month > 12)
+      {
+        return errc::invalid_month;
+      }
+
+      return make(
+        year,
+        static_cast<enum month>(month - 1),
+        day,
+        hour,
+        minute,
+        second,
+        nanosecond
+      );
     }
 
     /**
      * Returns date value.
      */
-    inline const class date& date() const
+    constexpr const class date& date() const noexcept
     {
       return m_date;
     }
@@ -157,7 +415,7 @@ namespace peelo::chrono
     /**
      * Returns year of the date.
      */
-    inline int year() const
+    constexpr int year() const noexcept
     {
       return m_date.year();
     }
@@ -165,7 +423,7 @@ namespace peelo::chrono
     /**
      * Returns month of the year.
      */
-    inline const enum month& month() const
+    constexpr const enum month& month() const noexcept
     {
       return m_date.month();
     }
@@ -173,7 +431,7 @@ namespace peelo::chrono
     /**
      * Returns day of the month (from 1 to 31) of the date.
      */
-    inline int day() const
+    constexpr int day() const noexcept
     {
       return m_date.day();
     }
@@ -181,7 +439,7 @@ namespace peelo::chrono
     /**
      * Returns day of the week for this date.
      */
-    inline weekday day_of_week() const
+    constexpr weekday day_of_week() const noexcept
     {
       return m_date.day_of_week();
     }
@@ -190,7 +448,7 @@ namespace peelo::chrono
      * Returns the day of the year (from 1 to 365 or 366 on leap years) for
      * this date.
      */
-    inline int day_of_year() const
+    constexpr int day_of_year() const noexcept
     {
       return m_date.day_of_year();
     }
@@ -198,7 +456,7 @@ namespace peelo::chrono
     /**
      * Returns the number of days in the year (365 or 366) for this date.
      */
-    inline int days_in_year() const
+    constexpr int days_in_year() const noexcept
     {
       return m_date.days_in_year();
     }
@@ -207,7 +465,7 @@ namespace peelo::chrono
      * Returns <code>true</code> if the year represented by the date is a leap
      * year.
      */
-    inline bool is_leap_year() const
+    constexpr bool is_leap_year() const noexcept
     {
       return m_date.is_leap_year();
     }
@@ -215,7 +473,7 @@ namespace peelo::chrono
     /**
      * Returns time value.
      */
-    inline const class time& time() const
+    constexpr const class time& time() const noexcept
     {
       return m_time;
     }
@@ -223,7 +481,7 @@ namespace peelo::chrono
     /**
      * Returns hour of the day (from 0 to 23).
      */
-    inline int hour() const
+    constexpr int hour() const noexcept
     {
       return m_time.hour();
     }
@@ -231,7 +489,7 @@ namespace peelo::chrono
     /**
      * Returns minute of the hour (from 0 to 59).
      */
-    inline int minute() const
+    constexpr int minute() const noexcept
     {
       return m_time.minute();
     }
@@ -239,38 +497,111 @@ namespace peelo::chrono
     /**
      * Returns second of the minute (from 0 to 59).
      */
-    inline int second() const
+    constexpr int second() const noexcept
     {
       return m_time.second();
     }
 
     /**
-     * Calculates UNIX timestamp from date and time.
+     * Returns millisecond of the second (from 0 to 999).
      */
-    inline std::int64_t timestamp() const
+    constexpr int millisecond() const noexcept
     {
-      return (
-        static_cast<std::int64_t>(m_time.second())
-        + (m_time.minute() * 60)
-        + (m_time.hour() * 3600)
-        + m_date.timestamp()
+      return m_time.millisecond();
+    }
+
+    /**
+     * Returns microsecond of the second (from 0 to 999 999).
+     */
+    constexpr int microsecond() const noexcept
+    {
+      return m_time.microsecond();
+    }
+
+    /**
+     * Returns nanosecond of the second (from 0 to 999 999 999).
+     */
+    constexpr int nanosecond() const noexcept
+    {
+      return m_time.nanosecond();
+    }
+
+    /**
+     * Calculates UNIX timestamp from date and time, which are interpreted as
+     * UTC. Fractions of a second are truncated.
+     */
+    constexpr std::int64_t timestamp() const noexcept
+    {
+      return to_utc_timestamp();
+    }
+
+    /**
+     * Calculates UNIX timestamp from date and time, which are interpreted as
+     * UTC. Does not depend on the time zone of the process. Fractions of a
+     * second are truncated.
+     */
+    constexpr std::int64_t to_utc_timestamp() const noexcept
+    {
+      return m_date.to_utc_timestamp() + m_time.second_of_day();
+    }
+
+    /**
+     * Converts the date and time into system clock time point with precision
+     * of one second. Fractions of a second are truncated.
+     */
+    constexpr sys_seconds to_sys_seconds() const noexcept
+    {
+      return sys_seconds(std::chrono::seconds(timestamp()));
+    }
+
+    /**
+     * Converts the date and time into system clock time point with precision
+     * of one nanosecond.
+     */
+    constexpr sys_time<std::chrono::nanoseconds> to_sys_time() const noexcept
+    {
+      return sys_time<std::chrono::nanoseconds>(
+        std::chrono::seconds(timestamp())
+        + std::chrono::nanoseconds(nanosecond())
       );
     }
 
     /**
-     * Uses strftime() function to format the datetime into a string.
+     * Formats the date and time into a string using given strftime() style
+     * format specification. See `format_pattern` for supported conversion
+     * specifiers. The date and time is treated as UTC by `%z` and `%s`.
      */
     std::string format(const std::string& format) const
     {
-      char buffer[BUFSIZ];
-      auto tm = make_tm(*this);
+      return this->format(format_pattern(format));
+    }
 
-      if (!std::strftime(buffer, BUFSIZ, format.c_str(), &tm))
-      {
-        throw std::runtime_error("strftime() failed");
-      }
+    /**
+     * Formats the date and time into a string using given compiled format
+     * pattern.
+     */
+    std::string format(const format_pattern& pattern) const
+    {
+      return pattern.render(format_fields());
+    }
+
+    /**
+     * Returns the date and time broken down into fields used by
+     * `format_pattern`.
+     */
+    format_pattern::fields format_fields() const noexcept
+    {
+      format_pattern::fields fields;
 
-      return buffer;
+      fields.year = year();
+      fields.month = static_cast<int>(month()) + 1;
+      fields.day = day();
+      fields.hour = hour();
+      fields.minute = minute();
+      fields.second = second();
+      fields.nanosecond = nanosecond();
+
+      return fields;
     }
 
     /**
@@ -278,7 +609,7 @@ namespace peelo::chrono
      *
      * \param that Other date and time to copy values from
      */
-    inline datetime& assign(const datetime& that)
+    constexpr datetime& assign(const datetime& that) noexcept
     {
       return assign(that.m_date, that.m_time);
     }
@@ -292,20 +623,22 @@ namespace peelo::chrono
      * \param hour   Hour of the date
      * \param minute Minute of the hour
      * \param second Second of the minute
+     * \param nanosecond Nanosecond of the second
      * \throw std::invalid_argument If given values do not construct a valid
      *                              date and time
      */
-    datetime& assign(
+    constexpr datetime& assign(
       int year,
       const enum month& month,
       int day,
       int hour,
       int minute,
-      int second
+      int second,
+      int nanosecond = 0
     )
     {
       m_date.assign(year, month, day);
-      m_time.assign(hour, minute, second);
+      m_time.assign(hour, minute, second, nanosecond);
 
       return *this;
     }
@@ -313,7 +646,10 @@ namespace peelo::chrono
     /**
      * Replaces values of the date and time with given values.
      */
-    datetime& assign(const class date& date, const class time& time)
+    constexpr datetime& assign(
+      const class date& date,
+      const class time& time
+    ) noexcept
     {
       m_date.assign(date);
       m_time.assign(time);
@@ -336,7 +672,7 @@ namespace peelo::chrono
      *
      * \param that Other date and time to test equality with
      */
-    inline bool equals(const datetime& that) const
+    constexpr bool equals(const datetime& that) const noexcept
     {
       return m_date.equals(that.m_date) && m_time.equals(that.m_time);
     }
@@ -344,23 +680,27 @@ namespace peelo::chrono
     /**
      * Tests whether date and time are equal with given values.
      */
-    inline bool equals(
+    constexpr bool equals(
       int year,
       const enum month& month,
       int day,
       int hour,
       int minute,
-      int second
-    ) const
+      int second,
+      int nanosecond = 0
+    ) const noexcept
     {
       return m_date.equals(year, month, day)
-        && m_time.equals(hour, minute, second);
+        && m_time.equals(hour, minute, second, nanosecond);
     }
 
     /**
      * Tests whether date and time are equal with given values.
      */
-    inline bool equals(const class date& date, const class time& time) const
+    constexpr bool equals(
+      const class date& date,
+      const class time& time
+    ) const noexcept
     {
       return m_date.equals(date) && m_time.equals(time);
     }
@@ -368,7 +708,7 @@ namespace peelo::chrono
     /**
      * Equality testing operator.
      */
-    inline bool operator==(const datetime& that) const
+    constexpr bool operator==(const datetime& that) const noexcept
     {
       return equals(that);
     }
@@ -376,7 +716,7 @@ namespace peelo::chrono
     /**
      * Non-equality testing operator.
      */
-    inline bool operator!=(const datetime& that) const
+    constexpr bool operator!=(const datetime& that) const noexcept
     {
       return !equals(that);
     }
@@ -387,7 +727,7 @@ namespace peelo::chrono
      * \param that Other datetime to compare this one against
      * \return     Integer value indicating comparison result
      */
-    int compare(const datetime& that) const
+    constexpr int compare(const datetime& that) const noexcept
     {
       const int cmp = m_date.compare(that.m_date);
 
@@ -402,14 +742,15 @@ namespace peelo::chrono
     /**
      * Compares this datetime value against given values.
      */
-    int compare(
+    constexpr int compare(
       int year,
       const enum month& month,
       int day,
       int hour,
       int minute,
-      int second
-    ) const
+      int second,
+      int nanosecond = 0
+    ) const noexcept
     {
       const int cmp = m_date.compare(year, month, day);
 
@@ -418,13 +759,16 @@ namespace peelo::chrono
         return cmp;
       }
 
-      return m_time.compare(hour, minute, second);
+      return m_time.compare(hour, minute, second, nanosecond);
     }
 
     /**
      * Compares this datetime value against given date and time values.
      */
-    int compare(const class date& date, const class time& time) const
+    constexpr int compare(
+      const class date& date,
+      const class time& time
+    ) const noexcept
     {
       const int cmp = m_date.compare(date);
 
@@ -439,7 +783,7 @@ namespace peelo::chrono
     /**
      * Comparison operator.
      */
-    inline bool operator<(const datetime& that) const
+    constexpr bool operator<(const datetime& that) const noexcept
     {
       return compare(that) < 0;
     }
@@ -447,7 +791,7 @@ namespace peelo::chrono
     /**
      * Comparison operator.
      */
-    inline bool operator>(const datetime& that) const
+    constexpr bool operator>(const datetime& that) const noexcept
     {
       return compare(that) > 0;
     }
@@ -455,7 +799,7 @@ namespace peelo::chrono
     /**
      * Comparison operator.
      */
-    inline bool operator<=(const datetime& that) const
+    constexpr bool operator<=(const datetime& that) const noexcept
     {
       return compare(that) <= 0;
     }
@@ -463,7 +807,7 @@ namespace peelo::chrono
     /**
      * Comparison operator.
      */
-    inline bool operator>=(const datetime& that) const
+    constexpr bool operator>=(const datetime& that) const noexcept
     {
       return compare(that) >= 0;
     }
@@ -471,7 +815,7 @@ namespace peelo::chrono
     /**
      * Increments date by one day.
      */
-    datetime& operator++()
+    constexpr datetime& operator++() noexcept
     {
       ++m_date;
 
@@ -481,7 +825,7 @@ namespace peelo::chrono
     /**
      * Increments date by one day.
      */
-    datetime operator++(int)
+    constexpr datetime operator++(int) noexcept
     {
       const datetime return_value(*this);
 
@@ -493,7 +837,7 @@ namespace peelo::chrono
     /**
      * Decrements date by one day.
      */
-    datetime& operator--()
+    constexpr datetime& operator--() noexcept
     {
       --m_date;
 
@@ -503,7 +847,7 @@ namespace peelo::chrono
     /**
      * Decrements date by one day.
      */
-    datetime operator--(int)
+    constexpr datetime operator--(int) noexcept
     {
       const datetime return_value(*this);
 
@@ -512,10 +856,72 @@ namespace peelo::chrono
       return return_value;
     }
 
+    /**
+     * Returns a copy of the datetime with given number of months added to
+     * the date. Time of the day is left unchanged.
+     *
+     * \param months Number of months to add, may be negative
+     * \param policy What to do when the day does not exist in the resulting
+     *               month
+     * \throw std::invalid_argument If the day does not exist in the resulting
+     *                              month and policy is
+     *                              `overflow_policy::error`
+     * \throw std::out_of_range     If the resulting year cannot be
+     *                              represented
+     */
+    constexpr datetime add_months(
+      std::int64_t months,
+      overflow_policy policy = overflow_policy::clamp
+    ) const
+    {
+      return datetime(m_date.add_months(months, policy), m_time);
+    }
+
+    /**
+     * Returns a copy of the datetime with given number of years added to the
+     * date. Time of the day is left unchanged.
+     *
+     * \param years  Number of years to add, may be negative
+     * \param policy What to do when the date is February 29th and the
+     *               resulting year is not a leap year
+     * \throw std::invalid_argument If the day does not exist in the resulting
+     *                              year and policy is `overflow_policy::error`
+     * \throw std::out_of_range     If the resulting year cannot be
+     *                              represented
+     */
+    constexpr datetime add_years(
+      std::int64_t years,
+      overflow_policy policy = overflow_policy::clamp
+    ) const
+    {
+      return datetime(m_date.add_years(years, policy), m_time);
+    }
+
+    /**
+     * Returns a copy of the datetime with given period added to the date.
+     * Time of the day is left unchanged.
+     *
+     * \param period Period to add
+     * \param policy What to do when the day does not exist in the month
+     *               resulting from adding years and months
+     * \throw std::invalid_argument If the day does not exist in the resulting
+     *                              month and policy is
+     *                              `overflow_policy::error`
+     * \throw std::out_of_range     If the resulting year cannot be
+     *                              represented
+     */
+    constexpr datetime add(
+      const class period& period,
+      overflow_policy policy = overflow_policy::clamp
+    ) const
+    {
+      return datetime(m_date.add(period, policy), m_time);
+    }
+
     /**
      * Adds given amount of days to the datetime and returns result.
      */
-    inline datetime operator+(int days) const
+    constexpr datetime operator+(int days) const noexcept
     {
       return datetime(m_date + days, m_time);
     }
@@ -523,7 +929,7 @@ namespace peelo::chrono
     /**
      * Substracts given amount of days from the datetime and returns result.
      */
-    inline datetime operator-(int days) const
+    constexpr datetime operator-(int days) const noexcept
     {
       return datetime(m_date - days, m_time);
     }
@@ -531,7 +937,7 @@ namespace peelo::chrono
     /**
      * Adds given amount of days to the datetime.
      */
-    datetime& operator+=(int days)
+    constexpr datetime& operator+=(int days) noexcept
     {
       m_date += days;
 
@@ -541,7 +947,7 @@ namespace peelo::chrono
     /**
      * Substracts given amount of days from the datetime.
      */
-    datetime& operator-=(int days)
+    constexpr datetime& operator-=(int days) noexcept
     {
       m_date -= days;
 
@@ -551,29 +957,95 @@ namespace peelo::chrono
     /**
      * Returns the difference between two datetimes.
      */
-    duration operator-(const datetime& that) const
+    constexpr duration operator-(const datetime& that) const noexcept
+    {
+      return duration(
+        timestamp() - that.timestamp(),
+        static_cast<std::int64_t>(nanosecond()) - that.nanosecond()
+      );
+    }
+
+    /**
+     * Adds given duration to the datetime and returns result.
+     */
+    constexpr datetime operator+(const duration& duration) const noexcept
     {
-      auto tm1 = make_tm(*this);
-      auto tm2 = make_tm(that);
-      const auto time1 = std::mktime(&tm1);
-      const auto time2 = std::mktime(&tm2);
+      std::int64_t days = 0;
+      const auto time = m_time.add(duration, days);
 
-      return duration(std::difftime(time1, time2));
+      return datetime(date::epoch_day(m_date.epoch_day() + days), time);
     }
 
-  private:
-    static std::tm make_tm(const datetime& dt)
+    /**
+     * Substracts given duration from the datetime and returns result.
+     */
+    constexpr datetime operator-(const duration& duration) const noexcept
+    {
+      return *this + -duration;
+    }
+
+    /**
+     * Adds given duration to the datetime.
+     */
+    constexpr datetime& operator+=(const duration& duration) noexcept
+    {
+      return assign(*this + duration);
+    }
+
+    /**
+     * Substracts given duration from the datetime.
+     */
+    constexpr datetime& operator-=(const duration& duration) noexcept
+    {
+      return assign(*this - duration);
+    }
+
+    /**
+     * Adds given period to the datetime and returns result, clamping the day
+     * to the end of the month when necessary.
+     *
+     * \throw std::out_of_range If the resulting year cannot be represented
+     */
+    constexpr datetime operator+(const class period& period) const
+    {
+      return datetime(m_date + period, m_time);
+    }
+
+    /**
+     * Substracts given period from the datetime and returns result, clamping
+     * the day to the end of the month when necessary.
+     *
+     * \throw std::out_of_range If the resulting year cannot be represented
+     */
+    constexpr datetime operator-(const class period& period) const
     {
-      std::tm tm = {0};
+      return datetime(m_date - period, m_time);
+    }
 
-      tm.tm_year = dt.year() - 1900;
-      tm.tm_mon = static_cast<int>(dt.month());
-      tm.tm_mday = dt.day();
-      tm.tm_hour = dt.hour();
-      tm.tm_min = dt.minute();
-      tm.tm_sec = dt.second();
+    /**
+     * Adds given period to the datetime, clamping the day to the end of the
+     * month when necessary.
+     *
+     * \throw std::out_of_range If the resulting year cannot be represented
+     */
+    constexpr datetime& operator+=(const class period& period)
+    {
+      m_date += period;
 
-      return tm;
+      return *this;
+    }
+
+    /**
+     * Substracts given period from the datetime, clamping the day to the end
+     * of the month when necessary.
+     *
+     * \throw std::out_of_range If the resulting year cannot be represented
+     */
+    constexpr datetime& operator-=(const class period& period)
+    {
+      m_date -= period;
+
+      return *this;
     }
 
   private:
@@ -583,12 +1055,53 @@ namespace peelo::chrono
     class time m_time;
   };
 
+  /**
+   * Parses ISO 8601 date and time from character range `[first, last)`, as
+   * `datetime::parse()` does. Any text after the time is left unparsed. On
+   * failure given value is not modified.
+   *
+   * \return Pointer one past the last character parsed, or `first` and
+   *         `std::errc::invalid_argument` if the input is malformed or
+   *         `std::errc::result_out_of_range` if the values are out of range
+   */
+  constexpr std::from_chars_result from_chars(
+    const char* first,
+    const char* last,
+    class datetime& datetime
+  ) noexcept
+  {
+    return utils::from_chars(first, last, datetime);
+  }
+
+  /**
+   * Writes textual presentation of date and time in the format used by
+   * `to_string()` into character range `[first, last)`.
+   *
+   * \return Pointer one past the last character written, or `last` and
+   *         `std::errc::value_too_large` if the range is too small
+   */
+  inline std::to_chars_result to_chars(
+    char* first,
+    char* last,
+    const class datetime& datetime
+  )
+  {
+    static const format_pattern pattern(datetime::format_rfc2822);
+
+    return pattern.to_chars(first, last, datetime.format_fields());
+  }
+
   /**
    * Returns textual presentation of date and time into the stream in RFC 2822
    * compliant format.
    */
   inline std::string to_string(const class datetime& datetime)
   {
-    return datetime.format(datetime::format_rfc2822);
+    char buffer[datetime::max_string_length];
+
+    return std::string(
+      buffer,
+      to_chars(buffer, buffer + sizeof(buffer), datetime).ptr
+    );
   }
 }
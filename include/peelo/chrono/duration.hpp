@@ -25,39 +25,88 @@
  */
 #pragma once
 
+#include <chrono>
 #include <cstdint>
 
 namespace peelo::chrono
 {
+#if defined(__cpp_lib_chrono) && __cpp_lib_chrono >= 201907L
+  using std::chrono::sys_time;
+  using std::chrono::sys_seconds;
+  using std::chrono::sys_days;
+#else
   /**
-   * Time based amount of time, such as '34.5 minutes'.
+   * Time point of the system clock with given precision. Equivalent to the
+   * alias template of the same name introduced in C++20.
+   */
+  template<class Duration>
+  using sys_time = std::chrono::time_point<
+    std::chrono::system_clock,
+    Duration
+  >;
+
+  /**
+   * Time point of the system clock with precision of one second.
+   */
+  using sys_seconds = sys_time<std::chrono::seconds>;
+
+  /**
+   * Time point of the system clock with precision of one day.
+   */
+  using sys_days = sys_time<
+    std::chrono::duration<std::int64_t, std::ratio<86400>>
+  >;
+#endif
+
+  /**
+   * Time based amount of time, such as '34.5 minutes', with nanosecond
+   * precision.
+   *
+   * The duration is stored as whole seconds and a nanosecond adjustment
+   * which is always within range from 0 to 999 999 999, so negative
+   * durations with fractional part have their seconds rounded towards
+   * negative infinity. For example -0.5 seconds is stored as -1 seconds and
+   * 500 000 000 nanoseconds.
    */
   class duration
   {
   public:
     using value_type = std::int64_t;
 
-    static const value_type hours_per_day = 24;
-    static const value_type minutes_per_hour = 60;
-    static const value_type minutes_per_day = 1440;
-    static const value_type seconds_per_minute = 60;
-    static const value_type seconds_per_hour = 3600;
-    static const value_type seconds_per_day = 86400;
+    static constexpr value_type hours_per_day = 24;
+    static constexpr value_type minutes_per_hour = 60;
+    static constexpr value_type minutes_per_day = 1440;
+    static constexpr value_type seconds_per_minute = 60;
+    static constexpr value_type seconds_per_hour = 3600;
+    static constexpr value_type seconds_per_day = 86400;
+    static constexpr value_type milliseconds_per_second = 1000;
+    static constexpr value_type microseconds_per_second = 1000000;
+    static constexpr value_type nanoseconds_per_second = 1000000000;
 
     /**
-     * Constructs new duration instance which spans given number of seconds.
+     * Constructs new duration instance which spans given number of seconds
+     * and nanoseconds.
      *
-     * \param seconds Seconds of the duration.
+     * \param seconds     Seconds of the duration.
+     * \param nanoseconds Nanoseconds added to the seconds, may be negative or
+     *                    exceed one second.
      */
-    explicit duration(value_type seconds = 0)
-      : m_seconds(seconds) {}
+    explicit constexpr duration(
+      value_type seconds = 0,
+      value_type nanoseconds = 0
+    ) noexcept
+      : m_seconds(seconds + floor_div(nanoseconds, nanoseconds_per_second))
+      , m_nanoseconds(static_cast<std::int32_t>(
+          nanoseconds - floor_div(nanoseconds, nanoseconds_per_second)
+          * nanoseconds_per_second
+        )) {}
 
     /**
      * Constructs new duration instance which spans given number of days.
      *
      * \param days Number of days in the duration.
      */
-    static inline duration of_days(value_type days)
+    static constexpr duration of_days(value_type days) noexcept
     {
       return duration(days * seconds_per_day);
     }
@@ -67,7 +116,7 @@ namespace peelo::chrono
      *
      * \param hours Number of hours in the duration.
      */
-    static inline duration of_hours(value_type hours)
+    static constexpr duration of_hours(value_type hours) noexcept
     {
       return duration(hours * seconds_per_hour);
     }
@@ -77,11 +126,65 @@ namespace peelo::chrono
      *
      * \param minutes Number of minutes in the duration.
      */
-    static inline duration of_minutes(value_type minutes)
+    static constexpr duration of_minutes(value_type minutes) noexcept
     {
       return duration(minutes * seconds_per_minute);
     }
 
+    /**
+     * Constructs new duration instance which spans given number of
+     * milliseconds.
+     *
+     * \param milliseconds Number of milliseconds in the duration.
+     */
+    static constexpr duration of_milliseconds(value_type milliseconds) noexcept
+    {
+      return of_fraction(milliseconds, milliseconds_per_second);
+    }
+
+    /**
+     * Constructs new duration instance which spans given number of
+     * microseconds.
+     *
+     * \param microseconds Number of microseconds in the duration.
+     */
+    static constexpr duration of_microseconds(value_type microseconds) noexcept
+    {
+      return of_fraction(microseconds, microseconds_per_second);
+    }
+
+    /**
+     * Constructs new duration instance which spans given number of
+     * nanoseconds.
+     *
+     * \param nanoseconds Number of nanoseconds in the duration.
+     */
+    static constexpr duration of_nanoseconds(value_type nanoseconds) noexcept
+    {
+      return duration(0, nanoseconds);
+    }
+
+    /**
+     * Constructs new duration instance from standard library duration. Values
+     * more precise than one nanosecond are truncated.
+     *
+     * \param duration Standard library duration to convert.
+     */
+    template<class Rep, class Period>
+    static constexpr duration from_chrono(
+      const std::chrono::duration<Rep, Period>& duration
+    ) noexcept
+    {
+      const auto seconds = std::chrono::floor<std::chrono::seconds>(duration);
+
+      return peelo::chrono::duration(
+        seconds.count(),
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+          duration - seconds
+        ).count()
+      );
+    }
+
     /**
      * Copy constructor.
      */
@@ -95,7 +198,7 @@ namespace peelo::chrono
     /**
      * Returns the number of days in the duration.
      */
-    inline value_type days() const
+    constexpr value_type days() const noexcept
     {
       return m_seconds / seconds_per_day;
     }
@@ -103,7 +206,7 @@ namespace peelo::chrono
     /**
      * Returns the number of hours in the duration.
      */
-    inline value_type hours() const
+    constexpr value_type hours() const noexcept
     {
       return m_seconds / seconds_per_hour;
     }
@@ -111,39 +214,86 @@ namespace peelo::chrono
     /**
      * Returns the number of minutes in the duration.
      */
-    inline value_type minutes() const
+    constexpr value_type minutes() const noexcept
     {
       return m_seconds / seconds_per_minute;
     }
 
     /**
-     * Returns the number of seconds in the duration.
+     * Returns the number of whole seconds in the duration.
      */
-    inline value_type seconds() const
+    constexpr value_type seconds() const noexcept
     {
       return m_seconds;
     }
 
+    /**
+     * Returns the total number of milliseconds in the duration.
+     */
+    constexpr value_type milliseconds() const noexcept
+    {
+      return m_seconds * milliseconds_per_second
+        + m_nanoseconds / (nanoseconds_per_second / milliseconds_per_second);
+    }
+
+    /**
+     * Returns the total number of microseconds in the duration.
+     */
+    constexpr value_type microseconds() const noexcept
+    {
+      return m_seconds * microseconds_per_second
+        + m_nanoseconds / (nanoseconds_per_second / microseconds_per_second);
+    }
+
+    /**
+     * Returns the total number of nanoseconds in the duration. The result
+     * overflows for durations longer than roughly 292 years.
+     */
+    constexpr value_type nanoseconds() const noexcept
+    {
+      return m_seconds * nanoseconds_per_second + m_nanoseconds;
+    }
+
+    /**
+     * Converts the duration into standard library duration. The result
+     * overflows for durations longer than roughly 292 years.
+     */
+    constexpr std::chrono::nanoseconds to_chrono() const noexcept
+    {
+      return std::chrono::nanoseconds(nanoseconds());
+    }
+
+    /**
+     * Returns the nanosecond adjustment of the duration (from 0 to
+     * 999 999 999), which is added to the whole seconds.
+     */
+    constexpr value_type nanosecond() const noexcept
+    {
+      return m_nanoseconds;
+    }
+
     /**
      * Assigns value from another duration into this one.
      *
      * \param that Other duration to copy seconds from.
      */
-    inline duration& assign(const duration& that)
+    constexpr duration& assign(const duration& that) noexcept
     {
       m_seconds = that.m_seconds;
+      m_nanoseconds = that.m_nanoseconds;
 
       return *this;
     }
 
     /**
-     * Replaces seconds in the duration with given number of seconds.
+     * Replaces the duration with given number of seconds.
      *
      * \param seconds Number of seconds in the duration.
      */
-    inline duration& assign(value_type seconds)
+    constexpr duration& assign(value_type seconds) noexcept
     {
       m_seconds = seconds;
+      m_nanoseconds = 0;
 
       return *this;
     }
@@ -161,7 +311,7 @@ namespace peelo::chrono
     /**
      * Assignment operator.
      */
-    inline duration& operator=(value_type seconds)
+    constexpr duration& operator=(value_type seconds) noexcept
     {
       return assign(seconds);
     }
@@ -173,9 +323,10 @@ namespace peelo::chrono
      * \return     A boolean flag indicating whether the two durations are
      *             equal or not.
      */
-    inline bool equals(const duration& that) const
+    constexpr bool equals(const duration& that) const noexcept
     {
-      return m_seconds == that.m_seconds;
+      return m_seconds == that.m_seconds
+        && m_nanoseconds == that.m_nanoseconds;
     }
 
     /**
@@ -185,15 +336,15 @@ namespace peelo::chrono
      * \return        A boolean flag to indicate whether the duration contains
      *                exactly given number of seconds.
      */
-    inline bool equals(value_type seconds) const
+    constexpr bool equals(value_type seconds) const noexcept
     {
-      return m_seconds == seconds;
+      return m_seconds == seconds && m_nanoseconds == 0;
     }
 
     /**
      * Equality testing operator.
      */
-    inline bool operator==(const duration& that) const
+    constexpr bool operator==(const duration& that) const noexcept
     {
       return equals(that);
     }
@@ -201,7 +352,7 @@ namespace peelo::chrono
     /**
      * Equality testing operator.
      */
-    inline bool operator==(value_type seconds) const
+    constexpr bool operator==(value_type seconds) const noexcept
     {
       return equals(seconds);
     }
@@ -209,7 +360,7 @@ namespace peelo::chrono
     /**
      * Non-equality testing operator.
      */
-    inline bool operator!=(const duration& that) const
+    constexpr bool operator!=(const duration& that) const noexcept
     {
       return !equals(that);
     }
@@ -217,7 +368,7 @@ namespace peelo::chrono
     /**
      * Non-equality testing operator.
      */
-    inline bool operator!=(value_type seconds) const
+    constexpr bool operator!=(value_type seconds) const noexcept
     {
       return !equals(seconds);
     }
@@ -228,15 +379,15 @@ namespace peelo::chrono
      * \param that Other duration to compare this one against.
      * \return     Integer value indicating comparison result.
      */
-    inline int compare(const duration& that) const
+    constexpr int compare(const duration& that) const noexcept
     {
-      if (m_seconds > that.m_seconds)
+      if (m_seconds != that.m_seconds)
       {
-        return 1;
+        return m_seconds > that.m_seconds ? 1 : -1;
       }
-      else if (m_seconds < that.m_seconds)
+      else if (m_nanoseconds != that.m_nanoseconds)
       {
-        return -1;
+        return m_nanoseconds > that.m_nanoseconds ? 1 : -1;
       } else {
         return 0;
       }
@@ -248,24 +399,15 @@ namespace peelo::chrono
      * \param seconds Number of seconds to compare the duration against.
      * \return        Integer value indicating comparison result.
      */
-    inline int compare(value_type seconds) const
+    constexpr int compare(value_type seconds) const noexcept
     {
-      if (m_seconds > seconds)
-      {
-        return 1;
-      }
-      else if (m_seconds < seconds)
-      {
-        return -1;
-      } else {
-        return 0;
-      }
+      return compare(duration(seconds));
     }
 
     /**
      * Comparison operator.
      */
-    inline bool operator<(const duration& that) const
+    constexpr bool operator<(const duration& that) const noexcept
     {
       return compare(that) < 0;
     }
@@ -273,7 +415,7 @@ namespace peelo::chrono
     /**
      * Comparison operator.
      */
-    inline bool operator<(value_type seconds) const
+    constexpr bool operator<(value_type seconds) const noexcept
     {
       return compare(seconds) < 0;
     }
@@ -281,7 +423,7 @@ namespace peelo::chrono
     /**
      * Comparison operator.
      */
-    inline bool operator>(const duration& that) const
+    constexpr bool operator>(const duration& that) const noexcept
     {
       return compare(that) > 0;
     }
@@ -289,7 +431,7 @@ namespace peelo::chrono
     /**
      * Comparison operator.
      */
-    inline bool operator>(value_type seconds) const
+    constexpr bool operator>(value_type seconds) const noexcept
     {
       return compare(seconds) > 0;
     }
@@ -297,7 +439,7 @@ namespace peelo::chrono
     /**
      * Comparison operator.
      */
-    inline bool operator<=(const duration& that) const
+    constexpr bool operator<=(const duration& that) const noexcept
     {
       return compare(that) <= 0;
     }
@@ -305,7 +447,7 @@ namespace peelo::chrono
     /**
      * Comparison operator.
      */
-    inline bool operator<=(value_type seconds) const
+    constexpr bool operator<=(value_type seconds) const noexcept
     {
       return compare(seconds) <= 0;
     }
@@ -313,7 +455,7 @@ namespace peelo::chrono
     /**
      * Comparison operator.
      */
-    inline bool operator>=(const duration& that) const
+    constexpr bool operator>=(const duration& that) const noexcept
     {
       return compare(that) >= 0;
     }
@@ -321,7 +463,7 @@ namespace peelo::chrono
     /**
      * Comparison operator.
      */
-    inline bool operator>=(value_type seconds) const
+    constexpr bool operator>=(value_type seconds) const noexcept
     {
       return compare(seconds) >= 0;
     }
@@ -329,7 +471,7 @@ namespace peelo::chrono
     /**
      * Increments duration by one second.
      */
-    duration& operator++()
+    constexpr duration& operator++() noexcept
     {
       ++m_seconds;
 
@@ -339,7 +481,7 @@ namespace peelo::chrono
     /**
      * Increments duration by one second.
      */
-    duration operator++(int)
+    constexpr duration operator++(int) noexcept
     {
       const duration return_value = duration(*this);
 
@@ -351,7 +493,7 @@ namespace peelo::chrono
     /**
      * Decrements duration by one second.
      */
-    duration& operator--()
+    constexpr duration& operator--() noexcept
     {
       --m_seconds;
 
@@ -361,7 +503,7 @@ namespace peelo::chrono
     /**
      * Decrements duration by one second.
      */
-    duration operator--(int)
+    constexpr duration operator--(int) noexcept
     {
       const duration return_value = duration(*this);
 
@@ -370,26 +512,56 @@ namespace peelo::chrono
       return return_value;
     }
 
+    /**
+     * Returns negation of the duration.
+     */
+    constexpr duration operator-() const noexcept
+    {
+      return duration(-m_seconds, -static_cast<value_type>(m_nanoseconds));
+    }
+
     /**
      * Adds given number of seconds to the duration and returns result.
      */
-    duration operator+(value_type seconds) const
+    constexpr duration operator+(value_type seconds) const noexcept
     {
-      return duration(m_seconds + seconds);
+      return duration(m_seconds + seconds, m_nanoseconds);
     }
 
     /**
      * Substracts given number of seconds from the duration and returns result.
      */
-    duration operator-(value_type seconds) const
+    constexpr duration operator-(value_type seconds) const noexcept
     {
-      return duration(m_seconds - seconds);
+      return duration(m_seconds - seconds, m_nanoseconds);
+    }
+
+    /**
+     * Adds another duration to the duration and returns result.
+     */
+    constexpr duration operator+(const duration& that) const noexcept
+    {
+      return duration(
+        m_seconds + that.m_seconds,
+        static_cast<value_type>(m_nanoseconds) + that.m_nanoseconds
+      );
+    }
+
+    /**
+     * Substracts another duration from the duration and returns result.
+     */
+    constexpr duration operator-(const duration& that) const noexcept
+    {
+      return duration(
+        m_seconds - that.m_seconds,
+        static_cast<value_type>(m_nanoseconds) - that.m_nanoseconds
+      );
     }
 
     /**
      * Adds given number of seconds to the duration.
      */
-    duration& operator+=(value_type seconds)
+    constexpr duration& operator+=(value_type seconds) noexcept
     {
       m_seconds += seconds;
 
@@ -399,15 +571,53 @@ namespace peelo::chrono
     /**
      * Substracts given number of seconds from the duration.
      */
-    duration& operator-=(value_type seconds)
+    constexpr duration& operator-=(value_type seconds) noexcept
     {
       m_seconds -= seconds;
 
       return *this;
     }
 
+    /**
+     * Adds another duration to the duration.
+     */
+    constexpr duration& operator+=(const duration& that) noexcept
+    {
+      return assign(*this + that);
+    }
+
+    /**
+     * Substracts another duration from the duration.
+     */
+    constexpr duration& operator-=(const duration& that) noexcept
+    {
+      return assign(*this - that);
+    }
+
+  private:
+    static constexpr value_type floor_div(value_type a, value_type b) noexcept
+    {
+      return a / b - (a % b < 0);
+    }
+
+    static constexpr duration of_fraction(
+      value_type value,
+      value_type units_per_second
+    ) noexcept
+    {
+      const auto seconds = floor_div(value, units_per_second);
+
+      return duration(
+        seconds,
+        (value - seconds * units_per_second)
+        * (nanoseconds_per_second / units_per_second)
+      );
+    }
+
   private:
-    /** Number of seconds in the duration. */
+    /** Number of whole seconds in the duration. */
     value_type m_seconds;
+    /** Nanosecond adjustment of the duration. */
+    std::int32_t m_nanoseconds;
   };
 }
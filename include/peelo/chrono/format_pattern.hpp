@@ -0,0 +1,1131 @@
+/*
+ * Copyright (c) 2016-2024, peelo.net
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <peelo/chrono/_utils.hpp>
+
+namespace peelo::chrono
+{
+  /**
+   * Compiled strftime() style format specification. The specification is
+   * parsed once into a list of instructions, which can then be used for
+   * rendering any number of values without going through the C library,
+   * so the output does not depend on the locale of the process.
+   *
+   * Supported conversion specifiers are those of strftime() in the "C"
+   * locale, with `%E` and `%O` modifiers ignored. In addition `%f` renders
+   * microseconds, `%N` nanoseconds of the second and `%:z` the offset from
+   * UTC with colon between hours and minutes. Unknown conversion specifiers
+   * are copied into the output as they are.
+   */
+  class format_pattern
+  {
+  public:
+    /**
+     * Broken down date and time given to `render()`. Fields which are not
+     * set default to midnight of UNIX epoch in UTC.
+     */
+    struct fields
+    {
+      /** Year of the date. */
+      std::int64_t year = 1970;
+      /** Month of the year (from 1 to 12). */
+      int month = 1;
+      /** Day of the month (from 1 to 31). */
+      int day = 1;
+      /** Hour of the day (from 0 to 23). */
+      int hour = 0;
+      /** Minute of the hour (from 0 to 59). */
+      int minute = 0;
+      /** Second of the minute (from 0 to 59). */
+      int second = 0;
+      /** Nanosecond of the second (from 0 to 999 999 999). */
+      int nanosecond = 0;
+      /** Offset from UTC in seconds. */
+      std::int32_t offset = 0;
+      /** Time zone abbreviation rendered by `%Z`. */
+      std::string_view abbreviation;
+    };
+
+    /**
+     * Compiles given format specification.
+     *
+     * \param specification strftime() style format specification
+     */
+    explicit format_pattern(std::string_view specification)
+      : m_calendar(false)
+      , m_length(0)
+      , m_regular_length(0)
+      , m_years(0)
+      , m_iso_years(0)
+      , m_offsets(0)
+      , m_colon_offsets(0)
+      , m_abbreviations(0)
+    {
+      compile(specification);
+    }
+
+    /**
+     * Copy constructor.
+     */
+    format_pattern(const format_pattern&) = default;
+
+    /**
+     * Move constructor.
+     */
+    format_pattern(format_pattern&&) = default;
+
+    /**
+     * Copy assignment operator.
+     */
+    format_pattern& operator=(const format_pattern&) = default;
+
+    /**
+     * Move assignment operator.
+     */
+    format_pattern& operator=(format_pattern&&) = default;
+
+    /**
+     * Renders given fields into a new string.
+     */
+    std::string render(const fields& value) const
+    {
+      char buffer[256];
+
+      if (max_length(value) <= sizeof(buffer))
+      {
+        return std::string(buffer, write(value, buffer));
+      }
+
+      std::string output;
+
+      render(value, output);
+
+      return output;
+    }
+
+    /**
+     * Renders given fields, appending the result into given string.
+     */
+    void render(const fields& value, std::string& output) const
+    {
+      const auto start = output.length();
+
+      output.resize(start + max_length(value));
+      output.resize(static_cast<std::string::size_type>(
+        write(value, &output[start]) - output.data()
+      ));
+    }
+
+    /**
+     * Renders given fields into character range `[first, last)`, without
+     * terminating null character.
+     *
+     * \return Pointer one past the last character written and default
+     *         constructed error code on success, or `last` and
+     *         `std::errc::value_too_large` if the range is too small, in
+     *         which case contents of the range are unspecified
+     */
+    std::to_chars_result to_chars(
+      char* first,
+      char* last,
+      const fields& value
+    ) const
+    {
+      const auto available = static_cast<std::size_t>(last - first);
+      const auto length = max_length(value);
+      char buffer[256];
+
+      if (length <= available)
+      {
+        return { write(value, first), std::errc() };
+      }
+      else if (length <= sizeof(buffer))
+      {
+        const auto end = write(value, buffer);
+
+        if (static_cast<std::size_t>(end - buffer) <= available)
+        {
+          return { std::copy(buffer, end, first), std::errc() };
+        }
+      } else {
+        const auto output = render(value);
+
+        if (output.length() <= available)
+        {
+          return {
+            std::copy(output.begin(), output.end(), first),
+            std::errc()
+          };
+        }
+      }
+
+      return { last, std::errc::value_too_large };
+    }
+
+    /**
+     * Renders given fields into given output iterator.
+     *
+     * \return Iterator one past the last character written
+     */
+    template<class OutputIt>
+    OutputIt format_to(OutputIt out, const fields& value) const
+    {
+      char buffer[256];
+
+      if (max_length(value) <= sizeof(buffer))
+      {
+        return std::copy(buffer, write(value, buffer), out);
+      }
+
+      const auto output = render(value);
+
+      return std::copy(output.begin(), output.end(), out);
+    }
+
+    /**
+     * Returns the maximum number of characters which rendering given fields
+     * can produce. When the fields other than the year are within their
+     * ranges, the bound takes the actual width of the year and the offset
+     * into account, so that it does not exceed the `max_string_length` of
+     * the types using the pattern.
+     */
+    std::string::size_type max_length(const fields& value) const noexcept
+    {
+      const auto abbreviations = m_abbreviations
+        * value.abbreviation.length();
+
+      if (!is_regular(value))
+      {
+        return m_length + abbreviations;
+      }
+
+      const auto year = year_width(value.year);
+
+      return m_regular_length
+        + abbreviations
+        + m_years * year
+        + m_iso_years * (year + 1)
+        + m_offsets * offset_width(value.offset, false)
+        + m_colon_offsets * offset_width(value.offset, true);
+    }
+
+  private:
+    enum class opcode : std::uint8_t
+    {
+      literal,
+      weekday_short,
+      weekday_full,
+      month_short,
+      month_full,
+      year,
+      year2,
+      century,
+      iso_year,
+      iso_year2,
+      iso_week,
+      week_sunday,
+      week_monday,
+      month,
+      day,
+      day_space,
+      day_of_year,
+      weekday_monday,
+      weekday_sunday,
+      hour,
+      hour12,
+      minute,
+      second,
+      am_pm,
+      am_pm_lower,
+      microsecond,
+      nanosecond,
+      offset,
+      offset_colon,
+      abbreviation,
+      timestamp
+    };
+
+    struct instruction
+    {
+      /** Operation to perform. */
+      opcode code;
+      /** Position of literal text in the literal buffer. */
+      std::uint32_t offset;
+      /** Length of literal text. */
+      std::uint32_t length;
+    };
+
+    struct iso_week_date
+    {
+      std::int64_t year;
+      int week;
+    };
+
+    static constexpr const char* weekday_names[7] =
+    {
+      "Sunday",
+      "Monday",
+      "Tuesday",
+      "Wednesday",
+      "Thursday",
+      "Friday",
+      "Saturday"
+    };
+
+    static constexpr const char* month_names[12] =
+    {
+      "January",
+      "February",
+      "March",
+      "April",
+      "May",
+      "June",
+      "July",
+      "August",
+      "September",
+      "October",
+      "November",
+      "December"
+    };
+
+    static constexpr char digit_pairs[] =
+      "00010203040506070809"
+      "10111213141516171819"
+      "20212223242526272829"
+      "30313233343536373839"
+      "40414243444546474849"
+      "50515253545556575859"
+      "60616263646566676869"
+      "70717273747576777879"
+      "80818283848586878889"
+      "90919293949596979899";
+
+    char* write(const fields& value, char* output) const
+    {
+      int weekday = 0;
+      int yday = 0;
+
+      if (m_calendar)
+      {
+        const auto days = utils::days_from_civil(
+          value.year,
+          value.month,
+          value.day
+        );
+
+        weekday = utils::weekday_from_days(days);
+        yday = static_cast<int>(
+          days - utils::days_from_civil(value.year, 1, 1)
+        );
+      }
+
+      for (const auto& step : m_instructions)
+      {
+        switch (step.code)
+        {
+          case opcode::literal:
+            output = copy(
+              output,
+              m_literals.data() + step.offset,
+              step.length
+            );
+            break;
+
+          case opcode::weekday_short:
+            output = copy(output, weekday_names[weekday], 3);
+            break;
+
+          case opcode::weekday_full:
+            output = copy(output, weekday_names[weekday]);
+            break;
+
+          case opcode::month_short:
+            output = copy(output, month_name(value.month), 3);
+            break;
+
+          case opcode::month_full:
+            output = copy(output, month_name(value.month));
+            break;
+
+          case opcode::year:
+            output = write_year(output, value.year);
+            break;
+
+          case opcode::year2:
+            output = write_pair(output, floor_mod(value.year, 100));
+            break;
+
+          case opcode::century:
+            output = write_pair(output, floor_div(value.year, 100));
+            break;
+
+          case opcode::iso_year:
+            output = write_year(
+              output,
+              iso_week(value.year, yday, weekday).year
+            );
+            break;
+
+          case opcode::iso_year2:
+            output = write_pair(
+              output,
+              floor_mod(iso_week(value.year, yday, weekday).year, 100)
+            );
+            break;
+
+          case opcode::iso_week:
+            output = write_pair(
+              output,
+              iso_week(value.year, yday, weekday).week
+            );
+            break;
+
+          case opcode::week_sunday:
+            output = write_pair(output, (yday + 7 - weekday) / 7);
+            break;
+
+          case opcode::week_monday:
+            output = write_pair(output, (yday + 7 - (weekday + 6) % 7) / 7);
+            break;
+
+          case opcode::month:
+            output = write_pair(output, value.month);
+            break;
+
+          case opcode::day:
+            output = write_pair(output, value.day);
+            break;
+
+          case opcode::day_space:
+            if (value.day >= 0 && value.day < 10)
+            {
+              *output++ = ' ';
+              *output++ = static_cast<char>('0' + value.day);
+            } else {
+              output = write_pair(output, value.day);
+            }
+            break;
+
+          case opcode::day_of_year:
+            *output++ = static_cast<char>('0' + (yday + 1) / 100 % 10);
+            output = write_pair(output, (yday + 1) % 100);
+            break;
+
+          case opcode::weekday_monday:
+            *output++ = static_cast<char>('0' + (weekday ? weekday : 7));
+            break;
+
+          case opcode::weekday_sunday:
+            *output++ = static_cast<char>('0' + weekday);
+            break;
+
+          case opcode::hour:
+            output = write_pair(output, value.hour);
+            break;
+
+          case opcode::hour12:
+            output = write_pair(
+              output,
+              value.hour % 12 ? value.hour % 12 : 12
+            );
+            break;
+
+          case opcode::minute:
+            output = write_pair(output, value.minute);
+            break;
+
+          case opcode::second:
+            output = write_pair(output, value.second);
+            break;
+
+          case opcode::am_pm:
+            output = copy(output, value.hour < 12 ? "AM" : "PM", 2);
+            break;
+
+          case opcode::am_pm_lower:
+            output = copy(output, value.hour < 12 ? "am" : "pm", 2);
+            break;
+
+          case opcode::microsecond:
+            output = write_fraction(output, value.nanosecond / 1000, 6);
+            break;
+
+          case opcode::nanosecond:
+            output = write_fraction(output, value.nanosecond, 9);
+            break;
+
+          case opcode::offset:
+          case opcode::offset_colon:
+            output = write_offset(
+              output,
+              value.offset,
+              step.code == opcode::offset_colon
+            );
+            break;
+
+          case opcode::abbreviation:
+            output = copy(
+              output,
+              value.abbreviation.data(),
+              value.abbreviation.length()
+            );
+            break;
+
+          case opcode::timestamp:
+            output = write_number(
+              output,
+              utils::days_from_civil(value.year, value.month, value.day) *
+              86400 +
+              value.hour * 3600 +
+              value.minute * 60 +
+              value.second -
+              value.offset
+            );
+            break;
+        }
+      }
+
+      return output;
+    }
+
+    void compile(std::string_view specification)
+    {
+      for (std::string_view::size_type i = 0; i < specification.length(); ++i)
+      {
+        if (specification[i] != '%' || i + 1 >= specification.length())
+        {
+          emit_literal(specification.substr(i, 1));
+          continue;
+        }
+
+        const auto start = i++;
+
+        if (
+          (specification[i] == 'E' || specification[i] == 'O') &&
+          i + 1 < specification.length()
+        )
+        {
+          ++i;
+        }
+        else if (
+          specification[i] == ':' &&
+          i + 1 < specification.length() &&
+          specification[i + 1] == 'z'
+        )
+        {
+          emit(opcode::offset_colon);
+          ++i;
+          continue;
+        }
+
+        if (!compile_specifier(specification[i]))
+        {
+          emit_literal(specification.substr(start, i - start + 1));
+        }
+      }
+    }
+
+    bool compile_specifier(char c)
+    {
+      switch (c)
+      {
+        case 'a':
+          m_calendar = true;
+          emit(opcode::weekday_short);
+          break;
+
+        case 'A':
+          m_calendar = true;
+          emit(opcode::weekday_full);
+          break;
+
+        case 'b':
+        case 'h':
+          emit(opcode::month_short);
+          break;
+
+        case 'B':
+          emit(opcode::month_full);
+          break;
+
+        case 'c':
+          compile("%a %b %e %H:%M:%S %Y");
+          break;
+
+        case 'C':
+          emit(opcode::century);
+          break;
+
+        case 'd':
+          emit(opcode::day);
+          break;
+
+        case 'D':
+        case 'x':
+          compile("%m/%d/%y");
+          break;
+
+        case 'e':
+          emit(opcode::day_space);
+          break;
+
+        case 'f':
+          emit(opcode::microsecond);
+          break;
+
+        case 'F':
+          compile("%Y-%m-%d");
+          break;
+
+        case 'g':
+          m_calendar = true;
+          emit(opcode::iso_year2);
+          break;
+
+        case 'G':
+          m_calendar = true;
+          emit(opcode::iso_year);
+          break;
+
+        case 'H':
+          emit(opcode::hour);
+          break;
+
+        case 'I':
+          emit(opcode::hour12);
+          break;
+
+        case 'j':
+          m_calendar = true;
+          emit(opcode::day_of_year);
+          break;
+
+        case 'm':
+          emit(opcode::month);
+          break;
+
+        case 'M':
+          emit(opcode::minute);
+          break;
+
+        case 'n':
+          emit_literal("\n");
+          break;
+
+        case 'N':
+          emit(opcode::nanosecond);
+          break;
+
+        case 'p':
+          emit(opcode::am_pm);
+          break;
+
+        case 'P':
+          emit(opcode::am_pm_lower);
+          break;
+
+        case 'r':
+          compile("%I:%M:%S %p");
+          break;
+
+        case 'R':
+          compile("%H:%M");
+          break;
+
+        case 's':
+          emit(opcode::timestamp);
+          break;
+
+        case 'S':
+          emit(opcode::second);
+          break;
+
+        case 't':
+          emit_literal("\t");
+          break;
+
+        case 'T':
+        case 'X':
+          compile("%H:%M:%S");
+          break;
+
+        case 'u':
+          m_calendar = true;
+          emit(opcode::weekday_monday);
+          break;
+
+        case 'U':
+          m_calendar = true;
+          emit(opcode::week_sunday);
+          break;
+
+        case 'V':
+          m_calendar = true;
+          emit(opcode::iso_week);
+          break;
+
+        case 'w':
+          m_calendar = true;
+          emit(opcode::weekday_sunday);
+          break;
+
+        case 'W':
+          m_calendar = true;
+          emit(opcode::week_monday);
+          break;
+
+        case 'y':
+          emit(opcode::year2);
+          break;
+
+        case 'Y':
+          emit(opcode::year);
+          break;
+
+        case 'z':
+          emit(opcode::offset);
+          break;
+
+        case 'Z':
+          emit(opcode::abbreviation);
+          break;
+
+        case '%':
+          emit_literal("%");
+          break;
+
+        default:
+          return false;
+      }
+
+      return true;
+    }
+
+    void emit(opcode code)
+    {
+      m_instructions.push_back({ code, 0, 0 });
+      if (code == opcode::abbreviation)
+      {
+        ++m_abbreviations;
+        return;
+      }
+      m_length += max_width(code);
+      switch (code)
+      {
+        case opcode::year:
+        case opcode::century:
+          ++m_years;
+          break;
+
+        case opcode::iso_year:
+          ++m_iso_years;
+          break;
+
+        case opcode::offset:
+          ++m_offsets;
+          break;
+
+        case opcode::offset_colon:
+          ++m_colon_offsets;
+          break;
+
+        default:
+          m_regular_length += regular_width(code);
+          break;
+      }
+    }
+
+    /**
+     * Returns the maximum number of characters produced by given operation.
+     * Numeric fields are rendered in full even when they are out of their
+     * range, so the limits cover any value of the field type.
+     */
+    static std::string::size_type max_width(opcode code) noexcept
+    {
+      switch (code)
+      {
+        case opcode::weekday_monday:
+        case opcode::weekday_sunday:
+          return 1;
+
+        case opcode::am_pm:
+        case opcode::am_pm_lower:
+          return 2;
+
+        case opcode::weekday_short:
+        case opcode::month_short:
+          return 3;
+
+        case opcode::microsecond:
+          return 6;
+
+        case opcode::weekday_full:
+        case opcode::month_full:
+        case opcode::nanosecond:
+          return 9;
+
+        case opcode::offset:
+        case opcode::offset_colon:
+          return 13;
+
+        case opcode::year:
+        case opcode::century:
+        case opcode::iso_year:
+        case opcode::timestamp:
+          return 20;
+
+        default:
+          return 11;
+      }
+    }
+
+    /**
+     * Returns the maximum number of characters produced by given operation
+     * for fields which are within their ranges. Operations depending on the
+     * year or the offset are not covered.
+     */
+    static std::string::size_type regular_width(opcode code) noexcept
+    {
+      switch (code)
+      {
+        case opcode::weekday_monday:
+        case opcode::weekday_sunday:
+          return 1;
+
+        case opcode::weekday_short:
+        case opcode::month_short:
+        case opcode::day_of_year:
+          return 3;
+
+        case opcode::microsecond:
+          return 6;
+
+        case opcode::weekday_full:
+        case opcode::month_full:
+        case opcode::nanosecond:
+          return 9;
+
+        case opcode::timestamp:
+          return 20;
+
+        default:
+          return 2;
+      }
+    }
+
+    /**
+     * Tells whether all fields except the year are within their ranges and
+     * the offset is less than 100 hours.
+     */
+    static constexpr bool is_regular(const fields& value) noexcept
+    {
+      return value.month >= 1 && value.month <= 12
+        && value.day >= 1 && value.day <= 31
+        && value.hour >= 0 && value.hour <= 23
+        && value.minute >= 0 && value.minute <= 59
+        && value.second >= 0 && value.second <= 60
+        && value.nanosecond >= 0 && value.nanosecond <= 999999999
+        && value.offset > -360000 && value.offset < 360000;
+    }
+
+    /**
+     * Returns the number of characters in given year, which is padded into
+     * at least four digits.
+     */
+    static constexpr std::string::size_type year_width(
+      std::int64_t year
+    ) noexcept
+    {
+      std::string::size_type width = year < 0 ? 2 : 1;
+
+      for (; year <= -10 || year >= 10; year /= 10)
+      {
+        ++width;
+      }
+
+      return width < 4 ? 4 : width;
+    }
+
+    /**
+     * Returns the number of characters in offset of less than 100 hours,
+     * which includes the seconds only when they are not zero.
+     */
+    static constexpr std::string::size_type offset_width(
+      std::int32_t offset,
+      bool colon
+    ) noexcept
+    {
+      if (offset % 60)
+      {
+        return colon ? 9 : 7;
+      }
+
+      return colon ? 6 : 5;
+    }
+
+    void emit_literal(std::string_view text)
+    {
+      if (
+        !m_instructions.empty() &&
+        m_instructions.back().code == opcode::literal &&
+        m_instructions.back().offset + m_instructions.back().length ==
+        m_literals.length()
+      )
+      {
+        m_instructions.back().length += static_cast<std::uint32_t>(
+          text.length()
+        );
+      } else {
+        m_instructions.push_back({
+          opcode::literal,
+          static_cast<std::uint32_t>(m_literals.length()),
+          static_cast<std::uint32_t>(text.length())
+        });
+      }
+      m_literals.append(text);
+      m_length += text.length();
+      m_regular_length += text.length();
+    }
+
+    static constexpr std::int64_t floor_div(std::int64_t a, std::int64_t b)
+    {
+      return a / b - (a % b < 0);
+    }
+
+    static constexpr std::int64_t floor_mod(std::int64_t a, std::int64_t b)
+    {
+      return a - floor_div(a, b) * b;
+    }
+
+    static const char* month_name(int month) noexcept
+    {
+      return month_names[static_cast<unsigned>(month - 1) % 12];
+    }
+
+    static char* copy(char* output, const char* text, std::size_t length)
+    {
+      for (std::size_t i = 0; i < length; ++i)
+      {
+        output[i] = text[i];
+      }
+
+      return output + length;
+    }
+
+    static char* copy(char* output, const char* text)
+    {
+      while (*text)
+      {
+        *output++ = *text++;
+      }
+
+      return output;
+    }
+
+    static char* write_number(char* output, std::int64_t value)
+    {
+      char digits[20];
+      auto magnitude = value < 0
+        ? ~static_cast<std::uint64_t>(value) + 1
+        : static_cast<std::uint64_t>(value);
+      int length = 0;
+
+      do
+      {
+        digits[length++] = static_cast<char>('0' + magnitude % 10);
+        magnitude /= 10;
+      }
+      while (magnitude);
+      if (value < 0)
+      {
+        *output++ = '-';
+      }
+      while (length > 0)
+      {
+        *output++ = digits[--length];
+      }
+
+      return output;
+    }
+
+    static char* write_pair(char* output, std::int64_t value)
+    {
+      if (value < 0 || value > 99)
+      {
+        return write_number(output, value);
+      }
+      output[0] = digit_pairs[value * 2];
+      output[1] = digit_pairs[value * 2 + 1];
+
+      return output + 2;
+    }
+
+    static char* write_year(char* output, std::int64_t year)
+    {
+      if (year < 0 || year > 9999)
+      {
+        return write_number(output, year);
+      }
+
+      return write_pair(write_pair(output, year / 100), year % 100);
+    }
+
+    static char* write_fraction(char* output, int value, int width)
+    {
+      for (int i = width - 1; i >= 0; --i)
+      {
+        output[i] = static_cast<char>('0' + value % 10);
+        value /= 10;
+      }
+
+      return output + width;
+    }
+
+    static char* write_offset(char* output, std::int32_t offset, bool colon)
+    {
+      const std::int64_t value = offset < 0
+        ? -static_cast<std::int64_t>(offset)
+        : offset;
+
+      *output++ = offset < 0 ? '-' : '+';
+      output = write_pair(output, value / 3600);
+      if (colon)
+      {
+        *output++ = ':';
+      }
+      output = write_pair(output, value / 60 % 60);
+      if (value % 60)
+      {
+        if (colon)
+        {
+          *output++ = ':';
+        }
+        output = write_pair(output, value % 60);
+      }
+
+      return output;
+    }
+
+    /**
+     * Returns the number of ISO 8601 weeks in given year, which is 53 when
+     * the year begins on Thursday, or on Wednesday in a leap year.
+     */
+    static int iso_weeks_in_year(std::int64_t year)
+    {
+      const auto first = utils::days_from_civil(year, 1, 1);
+      const auto length = utils::days_from_civil(year + 1, 1, 1) - first;
+      const auto weekday = utils::weekday_from_days(first);
+
+      return weekday == 4 || (weekday == 3 && length == 366) ? 53 : 52;
+    }
+
+    static iso_week_date iso_week(
+      std::int64_t year,
+      int yday,
+      int weekday
+    )
+    {
+      const auto week = (yday - (weekday + 6) % 7 + 10) / 7;
+
+      if (week < 1)
+      {
+        return { year - 1, iso_weeks_in_year(year - 1) };
+      }
+      else if (week > iso_weeks_in_year(year))
+      {
+        return { year + 1, 1 };
+      }
+
+      return { year, week };
+    }
+
+  private:
+    /** Compiled instructions. */
+    std::vector<instruction> m_instructions;
+    /** Literal text referenced by the instructions. */
+    std::string m_literals;
+    /** Whether day of the week or day of the year is needed. */
+    bool m_calendar;
+    /** Maximum length of rendered output, excluding abbreviations. */
+    std::string::size_type m_length;
+    /**
+     * Maximum length of rendered output for fields within their ranges,
+     * excluding abbreviations and operations counted below.
+     */
+    std::string::size_type m_regular_length;
+    /** Number of operations rendering the year or the century. */
+    std::string::size_type m_years;
+    /** Number of operations rendering the ISO 8601 week-based year. */
+    std::string::size_type m_iso_years;
+    /** Number of operations rendering offset without colons. */
+    std::string::size_type m_offsets;
+    /** Number of operations rendering offset with colons. */
+    std::string::size_type m_colon_offsets;
+    /** Number of times the time zone abbreviation is rendered. */
+    std::string::size_type m_abbreviations;
+  };
+
+  /**
+   * Renders value of any type which provides `format_fields()`, such as
+   * `date`, `time` or `datetime`, into character range `[first, last)`
+   * using given compiled format pattern. See `format_pattern::to_chars()`.
+   */
+  template<class T>
+  inline auto to_chars(
+    char* first,
+    char* last,
+    const T& value,
+    const format_pattern& pattern
+  ) -> decltype(value.format_fields(), std::to_chars_result())
+  {
+    return pattern.to_chars(first, last, value.format_fields());
+  }
+
+  /**
+   * Renders value of any type which provides `format_fields()`, such as
+   * `date`, `time` or `datetime`, into given output iterator using given
+   * compiled format pattern.
+   *
+   * \return Iterator one past the last character written
+   */
+  template<class OutputIt, class T>
+  inline auto format_to(
+    OutputIt out,
+    const T& value,
+    const format_pattern& pattern
+  ) -> decltype(value.format_fields(), OutputIt(out))
+  {
+    return pattern.format_to(out, value.format_fields());
+  }
+}
@@ -0,0 +1,345 @@
+/*
+ * Copyright (c) 2016-2024, peelo.net
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include <peelo/chrono/datetime.hpp>
+
+namespace peelo::chrono
+{
+  /**
+   * Point in time stored as number of seconds since UNIX epoch
+   * (1970-01-01 00:00:00 UTC) in a 64-bit integer. Copying, comparing and
+   * adding durations are plain integer operations, while calendar fields are
+   * calculated only when they are requested.
+   *
+   * Each field accessor decomposes the stored value separately, so callers
+   * which need several fields should convert the instant into datetime once
+   * with `datetime()`.
+   */
+  class instant
+  {
+  public:
+    using value_type = std::int64_t;
+
+    /**
+     * Constructs instant from given number of seconds since UNIX epoch.
+     *
+     * \param seconds Number of seconds since UNIX epoch
+     */
+    explicit constexpr instant(value_type seconds = 0) noexcept
+      : m_seconds(seconds) {}
+
+    /**
+     * Constructs instant from given date and time, which are interpreted as
+     * UTC. Fractions of a second are truncated.
+     *
+     * \param datetime Date and time to convert
+     */
+    explicit constexpr instant(const class datetime& datetime) noexcept
+      : m_seconds(datetime.timestamp()) {}
+
+    /**
+     * Constructs instant from midnight of given date, which is interpreted as
+     * UTC.
+     *
+     * \param date Date to convert
+     */
+    explicit constexpr instant(const class date& date) noexcept
+      : m_seconds(date.epoch_day() * duration::seconds_per_day) {}
+
+    /**
+     * Copy constructor.
+     */
+    instant(const instant&) = default;
+
+    /**
+     * Move constructor.
+     */
+    instant(instant&&) = default;
+
+    /**
+     * Returns current instant based on system clock.
+     */
+    static instant now()
+    {
+      const auto now = std::chrono::system_clock::now();
+
+      return instant(std::chrono::duration_cast<std::chrono::seconds>(
+        now.time_since_epoch()
+      ).count());
+    }
+
+    /**
+     * Returns number of seconds since UNIX epoch.
+     */
+    constexpr value_type timestamp() const noexcept
+    {
+      return m_seconds;
+    }
+
+    /**
+     * Decomposes the instant into date and time.
+     */
+    constexpr class datetime datetime() const noexcept
+    {
+      return chrono::datetime(date(), time());
+    }
+
+    /**
+     * Returns date part of the instant.
+     */
+    constexpr class date date() const noexcept
+    {
+      const auto result = utils::civil_from_days(epoch_day());
+
+      return chrono::date(
+        unchecked,
+        static_cast<int>(result.year),
+        static_cast<enum month>(result.month - 1),
+        result.day
+      );
+    }
+
+    /**
+     * Returns time part of the instant.
+     */
+    constexpr class time time() const noexcept
+    {
+      return chrono::time::second_of_day(second_of_day());
+    }
+
+    /**
+     * Returns year of the date.
+     */
+    constexpr int year() const noexcept
+    {
+      return static_cast<int>(utils::civil_from_days(epoch_day()).year);
+    }
+
+    /**
+     * Returns month of the year.
+     */
+    constexpr enum month month() const noexcept
+    {
+      return static_cast<enum month>(
+        utils::civil_from_days(epoch_day()).month - 1
+      );
+    }
+
+    /**
+     * Returns day of the month (from 1 to 31) of the date.
+     */
+    constexpr int day() const noexcept
+    {
+      return utils::civil_from_days(epoch_day()).day;
+    }
+
+    /**
+     * Returns day of the week.
+     */
+    constexpr weekday day_of_week() const noexcept
+    {
+      return static_cast<enum weekday>(utils::weekday_from_days(epoch_day()));
+    }
+
+    /**
+     * Returns hour of the day (from 0 to 23).
+     */
+    constexpr int hour() const noexcept
+    {
+      return second_of_day() / duration::seconds_per_hour;
+    }
+
+    /**
+     * Returns minute of the hour (from 0 to 59).
+     */
+    constexpr int minute() const noexcept
+    {
+      return (
+        second_of_day() / duration::seconds_per_minute
+        % duration::minutes_per_hour
+      );
+    }
+
+    /**
+     * Returns second of the minute (from 0 to 59).
+     */
+    constexpr int second() const noexcept
+    {
+      return second_of_day() % duration::seconds_per_minute;
+    }
+
+    /**
+     * Assignment operator.
+     */
+    instant& operator=(const instant&) = default;
+
+    /**
+     * Move operator.
+     */
+    instant& operator=(instant&&) = default;
+
+    /**
+     * Tests whether two instants are equal.
+     *
+     * \param that Other instant to test equality with
+     */
+    constexpr bool equals(const instant& that) const noexcept
+    {
+      return m_seconds == that.m_seconds;
+    }
+
+    /**
+     * Equality testing operator.
+     */
+    constexpr bool operator==(const instant& that) const noexcept
+    {
+      return equals(that);
+    }
+
+    /**
+     * Non-equality testing operator.
+     */
+    constexpr bool operator!=(const instant& that) const noexcept
+    {
+      return !equals(that);
+    }
+
+    /**
+     * Compares two instants against each other.
+     *
+     * \param that Other instant to compare this one against
+     * \return     Integer value indicating comparison result
+     */
+    constexpr int compare(const instant& that) const noexcept
+    {
+      return (m_seconds > that.m_seconds) - (m_seconds < that.m_seconds);
+    }
+
+    /**
+     * Comparison operator.
+     */
+    constexpr bool operator<(const instant& that) const noexcept
+    {
+      return m_seconds < that.m_seconds;
+    }
+
+    /**
+     * Comparison operator.
+     */
+    constexpr bool operator>(const instant& that) const noexcept
+    {
+      return m_seconds > that.m_seconds;
+    }
+
+    /**
+     * Comparison operator.
+     */
+    constexpr bool operator<=(const instant& that) const noexcept
+    {
+      return m_seconds <= that.m_seconds;
+    }
+
+    /**
+     * Comparison operator.
+     */
+    constexpr bool operator>=(const instant& that) const noexcept
+    {
+      return m_seconds >= that.m_seconds;
+    }
+
+    /**
+     * Adds given duration to the instant and returns result.
+     */
+    constexpr instant operator+(const duration& duration) const noexcept
+    {
+      return instant(m_seconds + duration.seconds());
+    }
+
+    /**
+     * Substracts given duration from the instant and returns result.
+     */
+    constexpr instant operator-(const duration& duration) const noexcept
+    {
+      return instant(m_seconds - duration.seconds());
+    }
+
+    /**
+     * Adds given duration to the instant.
+     */
+    constexpr instant& operator+=(const duration& duration) noexcept
+    {
+      m_seconds += duration.seconds();
+
+      return *this;
+    }
+
+    /**
+     * Substracts given duration from the instant.
+     */
+    constexpr instant& operator-=(const duration& duration) noexcept
+    {
+      m_seconds -= duration.seconds();
+
+      return *this;
+    }
+
+    /**
+     * Returns the difference between two instants.
+     */
+    constexpr duration operator-(const instant& that) const noexcept
+    {
+      return duration(m_seconds - that.m_seconds);
+    }
+
+  private:
+    constexpr std::int64_t epoch_day() const noexcept
+    {
+      const auto days = m_seconds / duration::seconds_per_day;
+
+      return m_seconds % duration::seconds_per_day < 0 ? days - 1 : days;
+    }
+
+    constexpr int second_of_day() const noexcept
+    {
+      return static_cast<int>(
+        m_seconds - epoch_day() * duration::seconds_per_day
+      );
+    }
+
+  private:
+    /** Number of seconds since UNIX epoch. */
+    value_type m_seconds;
+  };
+
+  /**
+   * Returns textual presentation of the instant in RFC 2822 compliant format.
+   */
+  inline std::string to_string(const instant& instant)
+  {
+    return to_string(instant.datetime());
+  }
+}
@@ -62,83 +62,46 @@ namespace peelo::chrono
     dec = 11
   };
 
-  month operator-(const month&, int);
-  month& operator-=(month&, int);
-
   /**
    * Increments month by given amount of months.
    */
-  inline month operator+(const month& original, int delta)
+  constexpr month operator+(const month& original, int delta) noexcept
   {
-    if (delta >= 0)
-    {
-      int result = static_cast<int>(original);
-
-      for (int i = 0; i < delta; ++i)
-      {
-        result = result < 11 ? result + 1 : 0;
-      }
-
-      return static_cast<month>(result);
-    }
-
-    return original - (-delta);
+    return static_cast<month>(
+      (static_cast<int>(original) + delta % 12 + 12) % 12
+    );
   }
 
   /**
    * Decrements month by given amount of months.
    */
-  inline month operator-(const month& original, int delta)
+  constexpr month operator-(const month& original, int delta) noexcept
   {
-    if (delta >= 0)
-    {
-      int result = static_cast<int>(original);
-
-      for (int i = 0; i < delta; ++i)
-      {
-        result = result > 0 ? result - 1 : 11;
-      }
-
-      return static_cast<month>(result);
-    }
-
-    return original + (-delta);
+    return static_cast<month>(
+      (static_cast<int>(original) - delta % 12 + 12) % 12
+    );
   }
 
   /**
    * Adds given number of months into the month.
    */
-  inline month& operator+=(month& original, int delta)
+  constexpr month& operator+=(month& original, int delta) noexcept
   {
-    int result = static_cast<int>(original);
-
-    for (int i = 0; i < delta; ++i)
-    {
-      result = result < 11 ? result + 1 : 0;
-    }
-
-    return original = static_cast<month>(result);
+    return original = original + delta;
   }
 
   /**
    * Substracts given number of months from the month.
    */
-  inline month& operator-=(month& original, int delta)
+  constexpr month& operator-=(month& original, int delta) noexcept
   {
-    int result = static_cast<int>(original);
-
-    for (int i = 0; i < delta; ++i)
-    {
-      result = result > 0 ? result - 1 : 11;
-    }
-
-    return original = static_cast<month>(result);
+    return original = original - delta;
   }
 
   /**
    * Increments month by one, wrapping to January if the month is December.
    */
-  inline month& operator++(month& original)
+  constexpr month& operator++(month& original) noexcept
   {
     return original += 1;
   }
@@ -146,7 +109,7 @@ namespace peelo::chrono
   /**
    * Decrements month by one, wrapping to December if the month is January.
    */
-  inline month& operator--(month& original)
+  constexpr month& operator--(month& original) noexcept
   {
     return original -= 1;
   }
@@ -154,7 +117,7 @@ namespace peelo::chrono
   /**
    * Increments month by one, wrapping to January if the month is December.
    */
-  inline month operator++(month& original, int)
+  constexpr month operator++(month& original, int) noexcept
   {
     const month return_value = original;
 
@@ -166,7 +129,7 @@ namespace peelo::chrono
   /**
    * Decrements month by one, wrapping to December if the month is January.
    */
-  inline month operator--(month& original, int)
+  constexpr month operator--(month& original, int) noexcept
   {
     const month return_value = original;
 
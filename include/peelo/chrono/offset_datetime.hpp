@@ -0,0 +1,633 @@
+/*
+ * Copyright (c) 2016-2024, peelo.net
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include <peelo/chrono/datetime.hpp>
+#include <peelo/chrono/instant.hpp>
+
+namespace peelo::chrono
+{
+  /**
+   * Date and time with a fixed offset from UTC, such as
+   * 2024-07-04T12:00:00-04:00.
+   *
+   * The date and time are stored as local time of the offset, so accessing
+   * them does not require any conversion, while conversion into UTC is a
+   * single addition. Equality and ordering compare the instants the values
+   * represent, so values with different offsets which refer to the same
+   * instant are equal.
+   */
+  class offset_datetime
+  {
+  public:
+    /**
+     * Largest supported offset from UTC in seconds, which is 23:59:59.
+     */
+    static constexpr std::int32_t max_offset = 86399;
+
+    /**
+     * Maximum length of the string produced by `to_string()` and
+     * `to_chars()` without format pattern, when the offset is within
+     * `max_offset`. Offsets given with `unchecked` may take up to
+     * `max_unchecked_string_length` characters.
+     */
+    static constexpr std::size_t max_string_length = 45;
+
+    /**
+     * Maximum length of the string produced by `to_string()` and
+     * `to_chars()` without format pattern for any offset, which can have
+     * up to six digits of hours.
+     */
+    static constexpr std::size_t max_unchecked_string_length =
+      max_string_length + 4;
+
+    /**
+     * Constructs date and time with offset from given local date and time
+     * and offset.
+     *
+     * \param datetime Local date and time
+     * \param offset   Offset from UTC in seconds, positive east of Greenwich
+     * \throw std::invalid_argument If given offset is out of range
+     */
+    explicit constexpr offset_datetime(
+      const class datetime& datetime = peelo::chrono::datetime(),
+      std::int32_t offset = 0
+    )
+      : m_datetime(datetime)
+      , m_offset(offset)
+    {
+      if (!is_valid_offset(offset))
+      {
+        PEELO_CHRONO_THROW(std::invalid_argument("invalid UTC offset"));
+      }
+    }
+
+    /**
+     * Constructs date and time with offset from given local date and time
+     * and offset without validating the offset.
+     */
+    constexpr offset_datetime(
+      unchecked_t,
+      const class datetime& datetime,
+      std::int32_t offset
+    ) noexcept
+      : m_datetime(datetime)
+      , m_offset(offset) {}
+
+    /**
+     * Copy constructor.
+     */
+    offset_datetime(const offset_datetime&) = default;
+
+    /**
+     * Move constructor.
+     */
+    offset_datetime(offset_datetime&&) = default;
+
+    /**
+     * Constructs date and time with offset from given local date and time
+     * and offset without throwing an exception.
+     *
+     * \param datetime Local date and time
+     * \param offset   Offset from UTC in seconds, positive east of Greenwich
+     * \return         Either the date and time with offset, or
+     *                 `errc::invalid_offset` if the offset is out of range
+     */
+    static constexpr result<offset_datetime> make(
+      const class datetime& datetime,
+      std::int32_t offset
+    ) noexcept
+    {
+      if (!is_valid_offset(offset))
+      {
+        return errc::invalid_offset;
+      }
+
+      return offset_datetime(unchecked, datetime, offset);
+    }
+
+    /**
+     * Constructs date and time with offset which represents given date and
+     * time in UTC.
+     *
+     * \param utc    Date and time in UTC
+     * \param offset Offset from UTC in seconds, positive east of Greenwich
+     * \throw std::invalid_argument If given offset is out of range
+     */
+    static constexpr offset_datetime from_utc(
+      const class datetime& utc,
+      std::int32_t offset
+    )
+    {
+      return offset_datetime(utc + duration(offset), offset);
+    }
+
+    /**
+     * Constructs date and time with offset which represents given instant.
+     *
+     * \param instant Instant to convert
+     * \param offset  Offset from UTC in seconds, positive east of Greenwich
+     * \throw std::invalid_argument If given offset is out of range
+     */
+    static constexpr offset_datetime from_instant(
+      const class instant& instant,
+      std::int32_t offset
+    )
+    {
+      return from_utc(instant.datetime(), offset);
+    }
+
+    /**
+     * Tests whether given offset from UTC is within the supported range.
+     */
+    static constexpr bool is_valid_offset(std::int32_t offset) noexcept
+    {
+      return offset >= -max_offset && offset <= max_offset;
+    }
+
+    /**
+     * Parses RFC 3339 date and time, such as "2024-07-04T12:00:00.5-04:00".
+     * Lower case "t" and "z", as well as a space in place of "T", are also
+     * accepted. Fractions of a second longer than nine digits are truncated.
+     *
+     * \param input Text to parse
+     * \return      Either the parsed date and time with offset, or an error
+     *              code describing why the input could not be parsed
+     */
+    static constexpr result<offset_datetime> parse(
+      std::string_view input
+    ) noexcept
+    {
+      std::size_t position = 0;
+      const auto value = parse(input, position);
+
+      if (value && position != input.length())
+      {
+        return errc::invalid_format;
+      }
+
+      return value;
+    }
+
+    /**
+     * Parses RFC 3339 date and time from given position of the input,
+     * advancing the position past the offset. Any text after the offset is
+     * left unparsed.
+     *
+     * \param input    Text to parse
+     * \param position Position where the date and time begins
+     * \return         Either the parsed date and time with offset, or an
+     *                 error code describing why the input could not be
+     *                 parsed
+     */
+    static constexpr result<offset_datetime> parse(
+      std::string_view input,
+      std::size_t& position
+    ) noexcept
+    {
+      const auto local = datetime::parse(input, position);
+
+      if (!local)
+      {
+        return local.error();
+      }
+
+      const auto offset = parse_offset(input, position);
+
+      if (!offset)
+      {
+        return offset.error();
+      }
+
+      return offset_datetime(unchecked, *local, *offset);
+    }
+
+    /**
+     * Parses offset from UTC, which is either "Z" or a sign followed by
+     * hours and optional minutes and seconds, such as "+05:30", "+0530" or
+     * "-08".
+     *
+     * \param input Text to parse
+     * \return      Either the parsed offset in seconds, or an error code
+     *              describing why the input could not be parsed
+     */
+    static constexpr result<std::int32_t> parse_offset(
+      std::string_view input
+    ) noexcept
+    {
+      std::size_t position = 0;
+      const auto offset = parse_offset(input, position);
+
+      if (offset && position != input.length())
+      {
+        return errc::invalid_format;
+      }
+
+      return offset;
+    }
+
+    /**
+     * Parses offset from UTC from given position of the input, advancing the
+     * position past the offset.
+     *
+     * \param input    Text to parse
+     * \param position Position where the offset begins
+     * \return         Either the parsed offset in seconds, or an error code
+     *                 describing why the input could not be parsed
+     */
+    static constexpr result<std::int32_t> parse_offset(
+      std::string_view input,
+      std::size_t& position
+    ) noexcept
+    {
+      bool negative = false;
+      int hours = 0;
+      int minutes = 0;
+      int seconds = 0;
+
+      if (!utils::parse_offset(
+        input,
+        position,
+        negative,
+        hours,
+        minutes,
+        seconds
+      ))
+      {
+        return errc::invalid_format;
+      }
+      else if (hours > 23 || minutes > 59 || seconds > 59)
+      {
+        return errc::invalid_offset;
+      }
+
+      const auto offset = hours * 3600 + minutes * 60 + seconds;
+
+      return static_cast<std::int32_t>(negative ? -offset : offset);
+    }
+
+    /**
+     * Returns the local date and time.
+     */
+    constexpr const class datetime& datetime() const noexcept
+    {
+      return m_datetime;
+    }
+
+    /**
+     * Returns offset from UTC in seconds, positive east of Greenwich.
+     */
+    constexpr std::int32_t offset() const noexcept
+    {
+      return m_offset;
+    }
+
+    /**
+     * Converts the value into date and time in UTC.
+     */
+    constexpr class datetime to_utc() const noexcept
+    {
+      return m_datetime - duration(m_offset);
+    }
+
+    /**
+     * Converts the value into instant. Fractions of a second are truncated.
+     */
+    constexpr class instant to_instant() const noexcept
+    {
+      return instant(timestamp());
+    }
+
+    /**
+     * Calculates UNIX timestamp of the instant the value represents.
+     * Fractions of a second are truncated.
+     */
+    constexpr std::int64_t timestamp() const noexcept
+    {
+      return m_datetime.timestamp() - m_offset;
+    }
+
+    /**
+     * Returns a copy of the value which represents the same instant with
+     * different offset from UTC.
+     *
+     * \param offset Offset from UTC in seconds, positive east of Greenwich
+     * \throw std::invalid_argument If given offset is out of range
+     */
+    constexpr offset_datetime with_offset(std::int32_t offset) const
+    {
+      return from_utc(to_utc(), offset);
+    }
+
+    /**
+     * Formats the local date and time into a string using given strftime()
+     * style format specification. `%z` is replaced with the offset in
+     * "+hhmm" format and `%:z` with the offset in "+hh:mm" format.
+     */
+    std::string format(const std::string& format) const
+    {
+      return this->format(format_pattern(format));
+    }
+
+    /**
+     * Formats the local date and time into a string using given compiled
+     * format pattern.
+     */
+    std::string format(const format_pattern& pattern) const
+    {
+      return pattern.render(format_fields());
+    }
+
+    /**
+     * Returns the local date and time and the offset broken down into
+     * fields used by `format_pattern`.
+     */
+    format_pattern::fields format_fields() const noexcept
+    {
+      auto fields = m_datetime.format_fields();
+
+      fields.offset = m_offset;
+
+      return fields;
+    }
+
+    /**
+     * Formats offset from UTC into a string, such as "+05:30". Seconds are
+     * included only when they are not zero.
+     *
+     * \param offset Offset from UTC in seconds
+     * \param colon  Whether hours and minutes are separated with colon
+     */
+    static std::string format_offset(std::int32_t offset, bool colon = true)
+    {
+      const auto value = offset < 0 ? -offset : offset;
+      const int fields[] = { value / 3600, value / 60 % 60, value % 60 };
+      std::string result(1, offset < 0 ? '-' : '+');
+
+      for (int i = 0; i < (fields[2] ? 3 : 2); ++i)
+      {
+        if (i > 0 && colon)
+        {
+          result += ':';
+        }
+        result += static_cast<char>('0' + fields[i] / 10);
+        result += static_cast<char>('0' + fields[i] % 10);
+      }
+
+      return result;
+    }
+
+    /**
+     * Assignment operator.
+     */
+    offset_datetime& operator=(const offset_datetime&) = default;
+
+    /**
+     * Move operator.
+     */
+    offset_datetime& operator=(offset_datetime&&) = default;
+
+    /**
+     * Tests whether two values represent the same instant.
+     */
+    constexpr bool equals(const offset_datetime& that) const noexcept
+    {
+      return compare(that) == 0;
+    }
+
+    /**
+     * Compares the instants two values represent.
+     *
+     * \param that Other value to compare this one against
+     * \return     Integer value indicating comparison result
+     */
+    constexpr int compare(const offset_datetime& that) const noexcept
+    {
+      const auto a = timestamp();
+      const auto b = that.timestamp();
+
+      if (a != b)
+      {
+        return a < b ? -1 : 1;
+      }
+
+      return (m_datetime.nanosecond() > that.m_datetime.nanosecond())
+        - (m_datetime.nanosecond() < that.m_datetime.nanosecond());
+    }
+
+    /**
+     * Equality testing operator.
+     */
+    constexpr bool operator==(const offset_datetime& that) const noexcept
+    {
+      return equals(that);
+    }
+
+    /**
+     * Non-equality testing operator.
+     */
+    constexpr bool operator!=(const offset_datetime& that) const noexcept
+    {
+      return !equals(that);
+    }
+
+    /**
+     * Comparison operator.
+     */
+    constexpr bool operator<(const offset_datetime& that) const noexcept
+    {
+      return compare(that) < 0;
+    }
+
+    /**
+     * Comparison operator.
+     */
+    constexpr bool operator>(const offset_datetime& that) const noexcept
+    {
+      return compare(that) > 0;
+    }
+
+    /**
+     * Comparison operator.
+     */
+    constexpr bool operator<=(const offset_datetime& that) const noexcept
+    {
+      return compare(that) <= 0;
+    }
+
+    /**
+     * Comparison operator.
+     */
+    constexpr bool operator>=(const offset_datetime& that) const noexcept
+    {
+      return compare(that) >= 0;
+    }
+
+    /**
+     * Adds given duration to the value and returns result. The offset is
+     * kept unchanged.
+     */
+    constexpr offset_datetime operator+(
+      const duration& duration
+    ) const noexcept
+    {
+      return offset_datetime(unchecked, m_datetime + duration, m_offset);
+    }
+
+    /**
+     * Substracts given duration from the value and returns result. The
+     * offset is kept unchanged.
+     */
+    constexpr offset_datetime operator-(
+      const duration& duration
+    ) const noexcept
+    {
+      return offset_datetime(unchecked, m_datetime - duration, m_offset);
+    }
+
+    /**
+     * Returns the difference between instants of two values.
+     */
+    constexpr duration operator-(const offset_datetime& that) const noexcept
+    {
+      return to_utc() - that.to_utc();
+    }
+
+  private:
+    /** Local date and time. */
+    class datetime m_datetime;
+    /** Offset from UTC in seconds, positive east of Greenwich. */
+    std::int32_t m_offset;
+  };
+
+  /**
+   * Parses RFC 3339 date and time from character range `[first, last)`, as
+   * `offset_datetime::parse()` does. Any text after the offset is left
+   * unparsed. On failure given value is not modified.
+   *
+   * \return Pointer one past the last character parsed, or `first` and
+   *         `std::errc::invalid_argument` if the input is malformed or
+   *         `std::errc::result_out_of_range` if the values are out of range
+   */
+  constexpr std::from_chars_result from_chars(
+    const char* first,
+    const char* last,
+    offset_datetime& datetime
+  ) noexcept
+  {
+    return utils::from_chars(first, last, datetime);
+  }
+
+  /**
+   * Writes textual presentation of the date and time with offset in the
+   * format used by `to_string()` into character range `[first, last)`.
+   *
+   * \return Pointer one past the last character written, or `last` and
+   *         `std::errc::value_too_large` if the range is too small
+   */
+  inline std::to_chars_result to_chars(
+    char* first,
+    char* last,
+    const offset_datetime& datetime
+  )
+  {
+    static const format_pattern local("%Y-%m-%dT%H:%M:%S");
+    static const format_pattern offset("%:z");
+    const auto fields = datetime.format_fields();
+    char scratch[offset_datetime::max_unchecked_string_length];
+    // Ranges which fit any output are written directly.
+    const bool direct = last - first >=
+      static_cast<std::ptrdiff_t>(sizeof(scratch));
+    const auto buffer = direct ? first : scratch;
+    const auto buffer_end = buffer + sizeof(scratch);
+    auto result = local.to_chars(buffer, buffer_end, fields);
+
+    if (result.ec != std::errc())
+    {
+      return { last, std::errc::value_too_large };
+    }
+
+    auto end = result.ptr;
+
+    if (fields.nanosecond)
+    {
+      if (buffer_end - end < 10)
+      {
+        return { last, std::errc::value_too_large };
+      }
+
+      auto value = fields.nanosecond;
+      int digits = 9;
+
+      for (; value % 10 == 0; value /= 10)
+      {
+        --digits;
+      }
+      *end++ = '.';
+      for (int i = digits - 1; i >= 0; --i)
+      {
+        end[i] = static_cast<char>('0' + value % 10);
+        value /= 10;
+      }
+      end += digits;
+    }
+    result = offset.to_chars(end, buffer_end, fields);
+    if (result.ec != std::errc())
+    {
+      return { last, std::errc::value_too_large };
+    }
+    end = result.ptr;
+
+    if (direct)
+    {
+      return { end, std::errc() };
+    }
+    else if (end - buffer > last - first)
+    {
+      return { last, std::errc::value_too_large };
+    }
+
+    return { std::copy(buffer, end, first), std::errc() };
+  }
+
+  /**
+   * Returns textual presentation of the date and time with offset in RFC
+   * 3339 format. Fraction of a second is included only when it is not zero.
+   */
+  inline std::string to_string(const offset_datetime& datetime)
+  {
+    char buffer[offset_datetime::max_unchecked_string_length];
+
+    return std::string(
+      buffer,
+      to_chars(buffer, buffer + sizeof(buffer), datetime).ptr
+    );
+  }
+}
@@ -0,0 +1,331 @@
+/*
+ * Copyright (c) 2016-2024, peelo.net
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include <functional>
+
+#include <peelo/chrono/datetime.hpp>
+
+namespace peelo::chrono
+{
+  /**
+   * Date and time packed into single 64-bit unsigned integer. The fields are
+   * laid out from the most significant bits to the least significant ones so
+   * that the integer order of two packed values equals their chronological
+   * order:
+   *
+   * | Bits  | Field                          |
+   * | ----- | ------------------------------ |
+   * | 63-32 | Year, biased by 2<sup>31</sup> |
+   * | 31-28 | Month of the year (0-11)       |
+   * | 27-23 | Day of the month (1-31)        |
+   * | 22-18 | Hour of the day (0-23)         |
+   * | 17-12 | Minute of the hour (0-59)      |
+   * | 11-6  | Second of the minute (0-59)    |
+   * | 5-0   | Reserved, always zero          |
+   *
+   * The type is trivially copyable, so it can be stored in `std::atomic`
+   * without locks on platforms with 64-bit atomic operations.
+   */
+  class packed_datetime
+  {
+  public:
+    using value_type = std::uint64_t;
+
+    /**
+     * Constructs packed date and time which is equal to default constructed
+     * datetime.
+     */
+    constexpr packed_datetime() noexcept
+      : m_value(pack(1900, month::jan, 1, 0, 0, 0)) {}
+
+    /**
+     * Constructs packed date and time from raw packed value.
+     *
+     * \param value Raw packed value, as returned by `value()`
+     */
+    explicit constexpr packed_datetime(value_type value) noexcept
+      : m_value(value) {}
+
+    /**
+     * Constructs packed date and time from given date and time. Fractions of
+     * a second are not stored.
+     *
+     * \param datetime Date and time to pack
+     */
+    explicit constexpr packed_datetime(
+      const class datetime& datetime
+    ) noexcept
+      : m_value(pack(
+          datetime.year(),
+          datetime.month(),
+          datetime.day(),
+          datetime.hour(),
+          datetime.minute(),
+          datetime.second()
+        )) {}
+
+    /**
+     * Copy constructor.
+     */
+    packed_datetime(const packed_datetime&) = default;
+
+    /**
+     * Move constructor.
+     */
+    packed_datetime(packed_datetime&&) = default;
+
+    /**
+     * Returns the raw packed value.
+     */
+    constexpr value_type value() const noexcept
+    {
+      return m_value;
+    }
+
+    /**
+     * Unpacks the value into date and time.
+     */
+    constexpr class datetime datetime() const noexcept
+    {
+      return chrono::datetime(
+        unchecked,
+        year(),
+        month(),
+        day(),
+        hour(),
+        minute(),
+        second()
+      );
+    }
+
+    /**
+     * Returns year of the date.
+     */
+    constexpr int year() const noexcept
+    {
+      return static_cast<int>(
+        static_cast<std::uint32_t>(m_value >> year_shift) ^ year_bias
+      );
+    }
+
+    /**
+     * Returns month of the year.
+     */
+    constexpr enum month month() const noexcept
+    {
+      return static_cast<enum month>(field(month_shift, 0xf));
+    }
+
+    /**
+     * Returns day of the month (from 1 to 31) of the date.
+     */
+    constexpr int day() const noexcept
+    {
+      return field(day_shift, 0x1f);
+    }
+
+    /**
+     * Returns hour of the day (from 0 to 23).
+     */
+    constexpr int hour() const noexcept
+    {
+      return field(hour_shift, 0x1f);
+    }
+
+    /**
+     * Returns minute of the hour (from 0 to 59).
+     */
+    constexpr int minute() const noexcept
+    {
+      return field(minute_shift, 0x3f);
+    }
+
+    /**
+     * Returns second of the minute (from 0 to 59).
+     */
+    constexpr int second() const noexcept
+    {
+      return field(second_shift, 0x3f);
+    }
+
+    /**
+     * Calculates UNIX timestamp from date and time.
+     */
+    constexpr std::int64_t timestamp() const noexcept
+    {
+      return (
+        utils::days_from_civil(year(), static_cast<int>(month()) + 1, day())
+        * duration::seconds_per_day
+        + hour() * duration::seconds_per_hour
+        + minute() * duration::seconds_per_minute
+        + second()
+      );
+    }
+
+    /**
+     * Assignment operator.
+     */
+    packed_datetime& operator=(const packed_datetime&) = default;
+
+    /**
+     * Move operator.
+     */
+    packed_datetime& operator=(packed_datetime&&) = default;
+
+    /**
+     * Tests whether two packed datetimes are equal.
+     *
+     * \param that Other packed date and time to test equality with
+     */
+    constexpr bool equals(const packed_datetime& that) const noexcept
+    {
+      return m_value == that.m_value;
+    }
+
+    /**
+     * Equality testing operator.
+     */
+    constexpr bool operator==(const packed_datetime& that) const noexcept
+    {
+      return equals(that);
+    }
+
+    /**
+     * Non-equality testing operator.
+     */
+    constexpr bool operator!=(const packed_datetime& that) const noexcept
+    {
+      return !equals(that);
+    }
+
+    /**
+     * Compares two packed datetimes against each other.
+     *
+     * \param that Other packed date and time to compare this one against
+     * \return     Integer value indicating comparison result
+     */
+    constexpr int compare(const packed_datetime& that) const noexcept
+    {
+      return (m_value > that.m_value) - (m_value < that.m_value);
+    }
+
+    /**
+     * Comparison operator.
+     */
+    constexpr bool operator<(const packed_datetime& that) const noexcept
+    {
+      return m_value < that.m_value;
+    }
+
+    /**
+     * Comparison operator.
+     */
+    constexpr bool operator>(const packed_datetime& that) const noexcept
+    {
+      return m_value > that.m_value;
+    }
+
+    /**
+     * Comparison operator.
+     */
+    constexpr bool operator<=(const packed_datetime& that) const noexcept
+    {
+      return m_value <= that.m_value;
+    }
+
+    /**
+     * Comparison operator.
+     */
+    constexpr bool operator>=(const packed_datetime& that) const noexcept
+    {
+      return m_value >= that.m_value;
+    }
+
+  private:
+    static constexpr int year_shift = 32;
+    static constexpr int month_shift = 28;
+    static constexpr int day_shift = 23;
+    static constexpr int hour_shift = 18;
+    static constexpr int minute_shift = 12;
+    static constexpr int second_shift = 6;
+    static constexpr std::uint32_t year_bias = 0x80000000u;
+
+    static constexpr value_type pack(
+      int year,
+      const enum month& month,
+      int day,
+      int hour,
+      int minute,
+      int second
+    ) noexcept
+    {
+      return (
+        static_cast<value_type>(static_cast<std::uint32_t>(year) ^ year_bias)
+          << year_shift
+        | static_cast<value_type>(month) << month_shift
+        | static_cast<value_type>(day) << day_shift
+        | static_cast<value_type>(hour) << hour_shift
+        | static_cast<value_type>(minute) << minute_shift
+        | static_cast<value_type>(second) << second_shift
+      );
+    }
+
+    constexpr int field(int shift, value_type mask) const noexcept
+    {
+      return static_cast<int>((m_value >> shift) & mask);
+    }
+
+  private:
+    /** Packed date and time. */
+    value_type m_value;
+  };
+
+  /**
+   * Returns textual presentation of date and time into the stream in RFC 2822
+   * compliant format.
+   */
+  inline std::string to_string(const packed_datetime& datetime)
+  {
+    return to_string(datetime.datetime());
+  }
+}
+
+namespace std
+{
+  template<>
+  struct hash<peelo::chrono::packed_datetime>
+  {
+    std::size_t operator()(
+      const peelo::chrono::packed_datetime& datetime
+    ) const noexcept
+    {
+      return std::hash<peelo::chrono::packed_datetime::value_type>()(
+        datetime.value()
+      );
+    }
+  };
+}
@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2016-2024, peelo.net
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include <cstdint>
+
+namespace peelo::chrono
+{
+  /**
+   * Policy which determines what happens when month based arithmetic ends up
+   * on a day which does not exist in the resulting month, such as when one
+   * month is added to January 31st.
+   */
+  enum class overflow_policy
+  {
+    /** Use the last day of the resulting month. */
+    clamp,
+    /** Carry the excess days over into the following month. */
+    overflow,
+    /** Fail with an error. */
+    error
+  };
+
+  /**
+   * Calendar based amount of time, such as '2 years, 3 months and 4 days'.
+   * Unlike duration, length of a period depends on the date it is applied to.
+   */
+  class period
+  {
+  public:
+    /**
+     * Constructs new period from given number of years, months and days.
+     *
+     * \param years  Number of years in the period
+     * \param months Number of months in the period
+     * \param days   Number of days in the period
+     */
+    explicit constexpr period(
+      int years = 0,
+      int months = 0,
+      int days = 0
+    ) noexcept
+      : m_years(years)
+      , m_months(months)
+      , m_days(days) {}
+
+    /**
+     * Constructs new period which spans given number of years.
+     */
+    static constexpr period of_years(int years) noexcept
+    {
+      return period(years, 0, 0);
+    }
+
+    /**
+     * Constructs new period which spans given number of months.
+     */
+    static constexpr period of_months(int months) noexcept
+    {
+      return period(0, months, 0);
+    }
+
+    /**
+     * Constructs new period which spans given number of days.
+     */
+    static constexpr period of_days(int days) noexcept
+    {
+      return period(0, 0, days);
+    }
+
+    /**
+     * Copy constructor.
+     */
+    period(const period&) = default;
+
+    /**
+     * Move constructor.
+     */
+    period(period&&) = default;
+
+    /**
+     * Returns the number of years in the period.
+     */
+    constexpr int years() const noexcept
+    {
+      return m_years;
+    }
+
+    /**
+     * Returns the number of months in the period.
+     */
+    constexpr int months() const noexcept
+    {
+      return m_months;
+    }
+
+    /**
+     * Returns the number of days in the period.
+     */
+    constexpr int days() const noexcept
+    {
+      return m_days;
+    }
+
+    /**
+     * Returns the total number of months in the period, combining years and
+     * months.
+     */
+    constexpr std::int64_t total_months() const noexcept
+    {
+      return static_cast<std::int64_t>(m_years) * 12 + m_months;
+    }
+
+    /**
+     * Assignment operator.
+     */
+    period& operator=(const period&) = default;
+
+    /**
+     * Move operator.
+     */
+    period& operator=(period&&) = default;
+
+    /**
+     * Tests whether two periods are equal or not.
+     *
+     * \param that Another period to compare this one with
+     */
+    constexpr bool equals(const period& that) const noexcept
+    {
+      return m_years == that.m_years
+        && m_months == that.m_months
+        && m_days == that.m_days;
+    }
+
+    /**
+     * Equality testing operator.
+     */
+    constexpr bool operator==(const period& that) const noexcept
+    {
+      return equals(that);
+    }
+
+    /**
+     * Non-equality testing operator.
+     */
+    constexpr bool operator!=(const period& that) const noexcept
+    {
+      return !equals(that);
+    }
+
+    /**
+     * Returns a period where each unit has been negated.
+     */
+    constexpr period operator-() const noexcept
+    {
+      return period(-m_years, -m_months, -m_days);
+    }
+
+    /**
+     * Adds two periods together unit by unit.
+     */
+    constexpr period operator+(const period& that) const noexcept
+    {
+      return period(
+        m_years + that.m_years,
+        m_months + that.m_months,
+        m_days + that.m_days
+      );
+    }
+
+    /**
+     * Substracts another period from this one unit by unit.
+     */
+    constexpr period operator-(const period& that) const noexcept
+    {
+      return period(
+        m_years - that.m_years,
+        m_months - that.m_months,
+        m_days - that.m_days
+      );
+    }
+
+  private:
+    /** Number of years in the period. */
+    int m_years;
+    /** Number of months in the period. */
+    int m_months;
+    /** Number of days in the period. */
+    int m_days;
+  };
+}
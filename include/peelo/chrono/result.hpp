@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2016-2024, peelo.net
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include <charconv>
+#include <string_view>
+
+#include <peelo/chrono/_utils.hpp>
+
+namespace peelo::chrono
+{
+  /**
+   * Error codes returned by the non-throwing factory and validation
+   * functions.
+   */
+  enum class errc
+  {
+    /** No error. */
+    ok = 0,
+    /** Month is not within range of the month enumeration. */
+    invalid_month,
+    /** Day is not within range of the month. */
+    invalid_day,
+    /** Hour is not within range from 0 to 23. */
+    invalid_hour,
+    /** Minute is not within range from 0 to 59. */
+    invalid_minute,
+    /** Second is not within range from 0 to 59. */
+    invalid_second,
+    /** Nanosecond is not within range from 0 to 999 999 999. */
+    invalid_nanosecond,
+    /** UTC offset is not within range from -23:59:59 to +23:59:59. */
+    invalid_offset,
+    /** Input does not match the expected textual format. */
+    invalid_format
+  };
+
+  /**
+   * Tag type used for selecting constructors which skip validation of given
+   * values. Should only be used with values which are already known to be
+   * valid.
+   */
+  struct unchecked_t
+  {
+    explicit unchecked_t() = default;
+  };
+
+  /**
+   * Tag value used for selecting constructors which skip validation.
+   */
+  inline constexpr unchecked_t unchecked{};
+
+  /**
+   * Result of a non-throwing factory function. Contains either a value or an
+   * error code.
+   */
+  template<class T>
+  class result
+  {
+  public:
+    using value_type = T;
+
+    /**
+     * Constructs successful result from given value.
+     */
+    constexpr result(const value_type& value) noexcept
+      : m_value(value)
+      , m_error(errc::ok) {}
+
+    /**
+     * Constructs failed result from given error code.
+     */
+    constexpr result(errc error) noexcept
+      : m_value()
+      , m_error(error) {}
+
+    /**
+     * Returns boolean flag indicating whether the result contains a value.
+     */
+    constexpr bool has_value() const noexcept
+    {
+      return m_error == errc::ok;
+    }
+
+    /**
+     * Returns boolean flag indicating whether the result contains a value.
+     */
+    explicit constexpr operator bool() const noexcept
+    {
+      return has_value();
+    }
+
+    /**
+     * Returns the error code, or `errc::ok` if the result contains a value.
+     */
+    constexpr errc error() const noexcept
+    {
+      return m_error;
+    }
+
+    /**
+     * Returns the contained value.
+     *
+     * \throw std::invalid_argument If the result does not contain a value
+     */
+    constexpr const value_type& value() const
+    {
+      if (!has_value())
+      {
+        PEELO_CHRONO_THROW(std::invalid_argument("result has no value"));
+      }
+
+      return m_value;
+    }
+
+    /**
+     * Returns the contained value, or given default value if the result does
+     * not contain a value.
+     */
+    constexpr value_type value_or(const value_type& default_value) const
+    {
+      return has_value() ? m_value : default_value;
+    }
+
+    /**
+     * Returns the contained value without checking whether it exists.
+     */
+    constexpr const value_type& operator*() const noexcept
+    {
+      return m_value;
+    }
+
+    /**
+     * Accesses the contained value without checking whether it exists.
+     */
+    constexpr const value_type* operator->() const noexcept
+    {
+      return &m_value;
+    }
+
+  private:
+    /** Contained value, default constructed on failure. */
+    value_type m_value;
+    /** Error code. */
+    errc m_error;
+  };
+
+  namespace utils
+  {
+    /**
+     * Implements `from_chars()` for types which provide static `parse()`
+     * function taking the input and position to parse from. Malformed input
+     * is reported as `std::errc::invalid_argument` and values out of range
+     * as `std::errc::result_out_of_range`.
+     */
+    template<class T>
+    constexpr std::from_chars_result from_chars(
+      const char* first,
+      const char* last,
+      T& value
+    ) noexcept
+    {
+      std::size_t position = 0;
+      const auto result = T::parse(
+        std::string_view(first, static_cast<std::size_t>(last - first)),
+        position
+      );
+
+      if (!result)
+      {
+        return {
+          first,
+          result.error() == errc::invalid_format
+            ? std::errc::invalid_argument
+            : std::errc::result_out_of_range
+        };
+      }
+      value = *result;
+
+      return { first + position, std::errc() };
+    }
+  }
+}
@@ -0,0 +1,332 @@
+/*
+ * Copyright (c) 2016-2024, peelo.net
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include <limits>
+
+#include <peelo/chrono/date.hpp>
+
+namespace peelo::chrono
+{
+  /**
+   * Compact date value which is stored as number of days since UNIX epoch
+   * (1970-01-01) in a 32-bit integer. Arithmetic and comparisons are single
+   * integer operations while year, month and day are calculated on demand.
+   */
+  class serial_date
+  {
+  public:
+    using value_type = std::int32_t;
+
+    /**
+     * Constructs serial date from given number of days since UNIX epoch.
+     *
+     * \param days Number of days since UNIX epoch
+     */
+    explicit constexpr serial_date(value_type days = 0) noexcept
+      : m_days(days) {}
+
+    /**
+     * Constructs serial date from given date.
+     *
+     * \param date Date to convert
+     * \throw std::out_of_range If the date cannot be represented as serial
+     *                          date
+     */
+    explicit constexpr serial_date(const class date& date)
+      : m_days(narrow(date.epoch_day())) {}
+
+    /**
+     * Copy constructor.
+     */
+    serial_date(const serial_date&) = default;
+
+    /**
+     * Move constructor.
+     */
+    serial_date(serial_date&&) = default;
+
+    /**
+     * Returns number of days since UNIX epoch.
+     */
+    constexpr value_type days() const noexcept
+    {
+      return m_days;
+    }
+
+    /**
+     * Converts serial date into date.
+     */
+    constexpr class date date() const noexcept
+    {
+      const auto result = utils::civil_from_days(m_days);
+
+      return chrono::date(
+        unchecked,
+        static_cast<int>(result.year),
+        static_cast<enum month>(result.month - 1),
+        result.day
+      );
+    }
+
+    /**
+     * Returns year of the date.
+     */
+    constexpr int year() const noexcept
+    {
+      return static_cast<int>(utils::civil_from_days(m_days).year);
+    }
+
+    /**
+     * Returns month of the year.
+     */
+    constexpr enum month month() const noexcept
+    {
+      return static_cast<enum month>(
+        utils::civil_from_days(m_days).month - 1
+      );
+    }
+
+    /**
+     * Returns day of the month (from 1 to 31) of the date.
+     */
+    constexpr int day() const noexcept
+    {
+      return utils::civil_from_days(m_days).day;
+    }
+
+    /**
+     * Returns week of day for this date.
+     */
+    constexpr weekday day_of_week() const noexcept
+    {
+      return static_cast<enum weekday>(utils::weekday_from_days(m_days));
+    }
+
+    /**
+     * Calculates UNIX timestamp from date.
+     */
+    constexpr std::int64_t timestamp() const noexcept
+    {
+      return static_cast<std::int64_t>(m_days) * duration::seconds_per_day;
+    }
+
+    /**
+     * Assignment operator.
+     */
+    serial_date& operator=(const serial_date&) = default;
+
+    /**
+     * Move operator.
+     */
+    serial_date& operator=(serial_date&&) = default;
+
+    /**
+     * Tests whether two dates are equal or not.
+     *
+     * \param that Another date to compare this one with
+     * \return     A boolean flag indicating whether the dates are equal or not
+     */
+    constexpr bool equals(const serial_date& that) const noexcept
+    {
+      return m_days == that.m_days;
+    }
+
+    /**
+     * Equality testing operator.
+     */
+    constexpr bool operator==(const serial_date& that) const noexcept
+    {
+      return equals(that);
+    }
+
+    /**
+     * Non-equality testing operator.
+     */
+    constexpr bool operator!=(const serial_date& that) const noexcept
+    {
+      return !equals(that);
+    }
+
+    /**
+     * Compares two dates against each other.
+     *
+     * \param that Other date to compare this one against
+     * \return     Integer value indicating comparison result
+     */
+    constexpr int compare(const serial_date& that) const noexcept
+    {
+      return (m_days > that.m_days) - (m_days < that.m_days);
+    }
+
+    /**
+     * Comparison operator.
+     */
+    constexpr bool operator<(const serial_date& that) const noexcept
+    {
+      return m_days < that.m_days;
+    }
+
+    /**
+     * Comparison operator.
+     */
+    constexpr bool operator>(const serial_date& that) const noexcept
+    {
+      return m_days > that.m_days;
+    }
+
+    /**
+     * Comparison operator.
+     */
+    constexpr bool operator<=(const serial_date& that) const noexcept
+    {
+      return m_days <= that.m_days;
+    }
+
+    /**
+     * Comparison operator.
+     */
+    constexpr bool operator>=(const serial_date& that) const noexcept
+    {
+      return m_days >= that.m_days;
+    }
+
+    /**
+     * Increments date by one day.
+     */
+    constexpr serial_date& operator++() noexcept
+    {
+      ++m_days;
+
+      return *this;
+    }
+
+    /**
+     * Increments date by one day.
+     */
+    constexpr serial_date operator++(int) noexcept
+    {
+      const serial_date return_value(*this);
+
+      ++m_days;
+
+      return return_value;
+    }
+
+    /**
+     * Decrements date by one day.
+     */
+    constexpr serial_date& operator--() noexcept
+    {
+      --m_days;
+
+      return *this;
+    }
+
+    /**
+     * Decrements date by one day.
+     */
+    constexpr serial_date operator--(int) noexcept
+    {
+      const serial_date return_value(*this);
+
+      --m_days;
+
+      return return_value;
+    }
+
+    /**
+     * Adds given number of days to the date and returns result.
+     */
+    constexpr serial_date operator+(value_type days) const noexcept
+    {
+      return serial_date(m_days + days);
+    }
+
+    /**
+     * Substracts given number of days from the date and returns result.
+     */
+    constexpr serial_date operator-(value_type days) const noexcept
+    {
+      return serial_date(m_days - days);
+    }
+
+    /**
+     * Adds given number of days to the date.
+     */
+    constexpr serial_date& operator+=(value_type days) noexcept
+    {
+      m_days += days;
+
+      return *this;
+    }
+
+    /**
+     * Substracts given number of days from the date.
+     */
+    constexpr serial_date& operator-=(value_type days) noexcept
+    {
+      m_days -= days;
+
+      return *this;
+    }
+
+    /**
+     * Returns the difference between two dates.
+     */
+    constexpr duration operator-(const serial_date& that) const noexcept
+    {
+      return duration::of_days(
+        static_cast<duration::value_type>(m_days) - that.m_days
+      );
+    }
+
+  private:
+    static constexpr value_type narrow(std::int64_t days)
+    {
+      if (days < std::numeric_limits<value_type>::min() ||
+          days > std::numeric_limits<value_type>::max())
+      {
+        PEELO_CHRONO_THROW(std::out_of_range("date out of serial range"));
+      }
+
+      return static_cast<value_type>(days);
+    }
+
+  private:
+    /** Number of days since UNIX epoch. */
+    value_type m_days;
+  };
+
+  /**
+   * Returns textual presentation of the date into the stream in RFC 2822
+   * compliant format.
+   */
+  inline std::string to_string(const serial_date& date)
+  {
+    return to_string(date.date());
+  }
+}
@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) 2016-2024, peelo.net
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#include <peelo/chrono/datetime.hpp>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#  include <intrin.h>
+#  define PEELO_CHRONO_TICK_RDTSC 1
+#elif defined(__x86_64__) || defined(__i386__)
+#  include <x86intrin.h>
+#  define PEELO_CHRONO_TICK_RDTSC 1
+#elif defined(__aarch64__) && !defined(_MSC_VER)
+#  define PEELO_CHRONO_TICK_CNTVCT 1
+#endif
+
+namespace peelo::chrono
+{
+  /**
+   * Relation between raw ticks of `tick_clock` and the system clock, used
+   * for converting captured ticks into durations and calendar time. The
+   * calibration consists of an anchor, which pairs a tick count with the
+   * system and steady clock readings taken at the same moment, and the
+   * length of a single tick in nanoseconds.
+   */
+  class tick_calibration
+  {
+  public:
+    using ticks_type = std::uint64_t;
+
+    /**
+     * Measures new calibration by comparing the tick counter against the
+     * steady clock over given window. Longer windows give more accurate
+     * results.
+     *
+     * \param window How long to measure
+     */
+    static tick_calibration measure(
+      std::chrono::nanoseconds window = std::chrono::milliseconds(10)
+    )
+    {
+      const auto first = take_anchor();
+
+      std::this_thread::sleep_for(window);
+
+      return tick_calibration(first, take_anchor());
+    }
+
+    /**
+     * Returns new calibration anchored to the current moment, with tick
+     * length measured over the whole time since this calibration was
+     * taken. Calling this periodically both tracks adjustments of the
+     * system clock and improves accuracy of the tick length.
+     */
+    tick_calibration refine() const
+    {
+      return tick_calibration(m_anchor, take_anchor());
+    }
+
+    /**
+     * Returns the length of a single tick in nanoseconds.
+     */
+    inline double nanoseconds_per_tick() const noexcept
+    {
+      return m_nanoseconds_per_tick;
+    }
+
+    /**
+     * Returns the tick count of the anchor.
+     */
+    inline ticks_type anchor_ticks() const noexcept
+    {
+      return m_anchor.ticks;
+    }
+
+    /**
+     * Converts difference between two tick counts into duration.
+     *
+     * \param first Tick count at the beginning
+     * \param last  Tick count at the end
+     */
+    inline duration to_duration(ticks_type first, ticks_type last)
+      const noexcept
+    {
+      return duration::of_nanoseconds(elapsed(first, last));
+    }
+
+    /**
+     * Converts tick count into system clock time point.
+     *
+     * \param ticks Tick count to convert
+     */
+    inline sys_time<std::chrono::nanoseconds> to_sys_time(ticks_type ticks)
+      const noexcept
+    {
+      return sys_time<std::chrono::nanoseconds>(std::chrono::nanoseconds(
+        m_anchor.system + elapsed(m_anchor.ticks, ticks)
+      ));
+    }
+
+    /**
+     * Converts tick count into date and time in UTC.
+     *
+     * \param ticks Tick count to convert
+     */
+    inline datetime to_datetime(ticks_type ticks) const noexcept
+    {
+      return datetime::from_sys_time(to_sys_time(ticks));
+    }
+
+  private:
+    struct anchor
+    {
+      /** Tick count. */
+      ticks_type ticks;
+      /** Nanoseconds since UNIX epoch according to system clock. */
+      std::int64_t system;
+      /** Nanoseconds according to steady clock. */
+      std::int64_t steady;
+    };
+
+    explicit tick_calibration(const anchor& first, const anchor& last)
+      : m_anchor(last)
+      , m_nanoseconds_per_tick(1.0)
+    {
+      const auto ticks = static_cast<std::int64_t>(last.ticks - first.ticks);
+
+      if (ticks > 0 && last.steady > first.steady)
+      {
+        m_nanoseconds_per_tick = static_cast<double>(
+          last.steady - first.steady
+        ) / static_cast<double>(ticks);
+      }
+    }
+
+    inline std::int64_t elapsed(ticks_type first, ticks_type last)
+      const noexcept
+    {
+      return static_cast<std::int64_t>(
+        static_cast<double>(static_cast<std::int64_t>(last - first)) *
+        m_nanoseconds_per_tick
+      );
+    }
+
+    static anchor take_anchor();
+
+  private:
+    anchor m_anchor;
+    double m_nanoseconds_per_tick;
+  };
+
+  /**
+   * Source of timestamps which can be captured in a handful of CPU cycles,
+   * meant for stamping events at high rates and converting them into
+   * calendar time only later, through `tick_calibration`.
+   *
+   * Reads the time stamp counter on x86 and the virtual counter on AArch64.
+   * Both are assumed to run at constant rate and to be synchronized between
+   * cores, which holds for all reasonably modern processors. On other
+   * platforms falls back to `std::chrono::steady_clock`, which uses
+   * `CLOCK_MONOTONIC` on POSIX systems.
+   */
+  class tick_clock
+  {
+  public:
+    using ticks_type = tick_calibration::ticks_type;
+
+    /**
+     * Tells whether the ticks are read directly from a hardware counter
+     * instead of the steady clock.
+     */
+#if defined(PEELO_CHRONO_TICK_RDTSC) || defined(PEELO_CHRONO_TICK_CNTVCT)
+    static constexpr bool is_hardware = true;
+#else
+    static constexpr bool is_hardware = false;
+#endif
+
+    /**
+     * Returns current value of the tick counter.
+     */
+    static inline ticks_type now() noexcept
+    {
+#if defined(PEELO_CHRONO_TICK_RDTSC)
+      return static_cast<ticks_type>(__rdtsc());
+#elif defined(PEELO_CHRONO_TICK_CNTVCT)
+      ticks_type value;
+
+      asm volatile("mrs %0, cntvct_el0" : "=r"(value));
+
+      return value;
+#else
+      return static_cast<ticks_type>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now().time_since_epoch()
+        ).count()
+      );
+#endif
+    }
+
+    /**
+     * Returns the process wide calibration, which is measured when this
+     * function is called for the first time.
+     */
+    static tick_calibration calibration()
+    {
+      auto& state = shared();
+      std::lock_guard<std::mutex> lock(state.mutex);
+
+      return state.calibration;
+    }
+
+    /**
+     * Refines the process wide calibration and returns the result. Should
+     * be called periodically, for example whenever captured ticks are
+     * exported, to keep conversions in line with the system clock.
+     */
+    static tick_calibration recalibrate()
+    {
+      auto& state = shared();
+      std::lock_guard<std::mutex> lock(state.mutex);
+
+      return state.calibration = state.calibration.refine();
+    }
+
+  private:
+    struct shared_state
+    {
+      std::mutex mutex;
+      tick_calibration calibration = tick_calibration::measure();
+    };
+
+    static shared_state& shared()
+    {
+      static shared_state state;
+
+      return state;
+    }
+  };
+
+  inline tick_calibration::anchor tick_calibration::take_anchor()
+  {
+    const auto before = tick_clock::now();
+    const auto system = std::chrono::system_clock::now();
+    const auto steady = std::chrono::steady_clock::now();
+    const auto after = tick_clock::now();
+
+    return {
+      before + (after - before) / 2,
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+        system.time_since_epoch()
+      ).count(),
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+        steady.time_since_epoch()
+      ).count()
+    };
+  }
+}
+
+#undef PEELO_CHRONO_TICK_RDTSC
+#undef PEELO_CHRONO_TICK_CNTVCT
@@ -29,40 +29,66 @@
 #include <stdexcept>
 #include <string>
 
-#if !defined(BUFSIZ)
-# define BUFSIZ 1024
-#endif
-
-#include <peelo/chrono/_utils.hpp>
+#include <peelo/chrono/duration.hpp>
+#include <peelo/chrono/format_pattern.hpp>
+#include <peelo/chrono/result.hpp>
 
 namespace peelo::chrono
 {
   /**
-   * Time value based on 24 hour clock.
+   * Time value based on 24 hour clock, with nanosecond precision.
    */
   class time
   {
   public:
+    /**
+     * Maximum length of the string produced by `to_string()` and
+     * `to_chars()` without format pattern.
+     */
+    static constexpr std::size_t max_string_length = 8;
+
     /**
      * Constructs new instance of time from given values.
      *
-     * \param hour   Hour of the day
-     * \param minute Minute of the hour
-     * \param second Second of the minute
+     * \param hour       Hour of the day
+     * \param minute     Minute of the hour
+     * \param second     Second of the minute
+     * \param nanosecond Nanosecond of the second
      * \throw std::invalid_argument If given values cannot be used to construct
      *                              valid time
      */
-    explicit time(int hour = 0, int minute = 0, int second = 0)
-      : m_hour(hour)
-      , m_minute(minute)
-      , m_second(second)
+    explicit constexpr time(
+      int hour = 0,
+      int minute = 0,
+      int second = 0,
+      int nanosecond = 0
+    )
+      : m_nanoseconds(pack(hour, minute, second, nanosecond))
     {
-      if (!is_valid(hour, minute, second))
+      if (!is_valid(hour, minute, second, nanosecond))
       {
-        throw std::invalid_argument("invalid time value");
+        PEELO_CHRONO_THROW(std::invalid_argument("invalid time value"));
       }
     }
 
+    /**
+     * Constructs new instance of time from given values without validating
+     * them.
+     *
+     * \param hour       Hour of the day
+     * \param minute     Minute of the hour
+     * \param second     Second of the minute
+     * \param nanosecond Nanosecond of the second
+     */
+    constexpr time(
+      unchecked_t,
+      int hour,
+      int minute,
+      int second,
+      int nanosecond = 0
+    ) noexcept
+      : m_nanoseconds(pack(hour, minute, second, nanosecond)) {}
+
     /**
      * Copy constructor.
      */
@@ -74,74 +100,292 @@ namespace peelo::chrono
     time(time&&) = default;
 
     /**
-     * Returns current time based on system clock.
+     * Constructs new instance of time from given values without throwing an
+     * exception.
+     *
+     * \param hour       Hour of the day
+     * \param minute     Minute of the hour
+     * \param second     Second of the minute
+     * \param nanosecond Nanosecond of the second
+     * \return           Either the time, or an error code describing why
+     *                   given values do not construct a valid time
+     */
+    static constexpr result<time> make(
+      int hour,
+      int minute,
+      int second,
+      int nanosecond = 0
+    ) noexcept
+    {
+      const auto error = validate(hour, minute, second, nanosecond);
+
+      if (error != errc::ok)
+      {
+        return error;
+      }
+
+      return time(unchecked, hour, minute, second, nanosecond);
+    }
+
+    /**
+     * Constructs time from given number of seconds since midnight. Values
+     * outside of a single day wrap around.
+     *
+     * \param seconds Number of seconds since midnight
+     */
+    static constexpr time second_of_day(std::int64_t seconds) noexcept
+    {
+      return time(
+        raw_t(),
+        wrap(seconds % seconds_per_day * nanoseconds_per_second)
+      );
+    }
+
+    /**
+     * Constructs time from given number of nanoseconds since midnight. Values
+     * outside of a single day wrap around.
+     *
+     * \param nanoseconds Number of nanoseconds since midnight
+     */
+    static constexpr time nanosecond_of_day(std::int64_t nanoseconds) noexcept
+    {
+      return time(raw_t(), wrap(nanoseconds));
+    }
+
+    /**
+     * Returns current time based on given clock, which defaults to system
+     * clock. The clock must measure time since UNIX epoch, such as
+     * `coarse_clock` does. Local time is only computed again when the second
+     * changes. A change of the time zone of the process, for example with
+     * `tzset()`, is therefore only seen from the next second onwards.
      *
      * \throw std::runtime_error If current time cannot be extracted from the
      *                           system for some reason
      */
+    template<class Clock = std::chrono::system_clock>
     static time now()
     {
-      const auto now = std::chrono::system_clock::now();
-      const auto ts = std::chrono::system_clock::to_time_t(now);
-      const auto result = utils::localtime(ts);
+      int nanosecond;
+      const auto result = utils::localtime_now<Clock>(nanosecond);
+
+      return time(
+        unchecked,
+        result.tm_hour,
+        result.tm_min,
+        result.tm_sec,
+        nanosecond
+      );
+    }
+
+    /**
+     * Validates given time values.
+     *
+     * \param hour       Hour of the day
+     * \param minute     Minute of the hour
+     * \param second     Second of the minute
+     * \param nanosecond Nanosecond of the second
+     * \return           `errc::ok` if given values construct a valid time, or
+     *                   an error code describing the first invalid value
+     */
+    static constexpr errc validate(
+      int hour,
+      int minute,
+      int second,
+      int nanosecond = 0
+    ) noexcept
+    {
+      if (hour < 0 || hour > 23)
+      {
+        return errc::invalid_hour;
+      }
+      else if (minute < 0 || minute > 59)
+      {
+        return errc::invalid_minute;
+      }
+      else if (second < 0 || second > 59)
+      {
+        return errc::invalid_second;
+      }
+      else if (nanosecond < 0 || nanosecond >= nanoseconds_per_second)
+      {
+        return errc::invalid_nanosecond;
+      }
 
-      return time(result.tm_hour, result.tm_min, result.tm_sec);
+      return errc::ok;
     }
 
     /**
      * Tests whether given values are valid time.
      *
-     * \param hour   Hour of the day
-     * \param minute Minute of the hour
-     * \param second Second of the minute
-     * \return       A boolean flag indicating whether an valid time can be
-     *               constructed from given values
+     * \param hour       Hour of the day
+     * \param minute     Minute of the hour
+     * \param second     Second of the minute
+     * \param nanosecond Nanosecond of the second
+     * \return           A boolean flag indicating whether an valid time can be
+     *                   constructed from given values
      */
-    static inline bool is_valid(int hour, int minute, int second)
+    static constexpr bool is_valid(
+      int hour,
+      int minute,
+      int second,
+      int nanosecond = 0
+    ) noexcept
     {
-      return (hour >= 0 && hour <= 23)
-        && (minute >= 0 && minute <= 59)
-        && (second >= 0 && second <= 59);
+      return validate(hour, minute, second, nanosecond) == errc::ok;
+    }
+
+    /**
+     * Parses ISO 8601 time of day in extended format, with optional
+     * fraction of a second, such as "12:30:00" or "12:30:00.25". Fractions
+     * longer than nine digits are truncated.
+     *
+     * \param input Text to parse
+     * \return      Either the parsed time, or an error code describing why
+     *              the input could not be parsed
+     */
+    static constexpr result<time> parse(std::string_view input) noexcept
+    {
+      std::size_t position = 0;
+      const auto value = parse(input, position);
+
+      if (value && position != input.length())
+      {
+        return errc::invalid_format;
+      }
+
+      return value;
+    }
+
+    /**
+     * Parses ISO 8601 time of day in extended format from given position of
+     * the input, advancing the position past the time. Any text after the
+     * time is left unparsed.
+     *
+     * \param input    Text to parse
+     * \param position Position where the time begins
+     * \return         Either the parsed time, or an error code describing
+     *                 why the input could not be parsed
+     */
+    static constexpr result<time> parse(
+      std::string_view input,
+      std::size_t& position
+    ) noexcept
+    {
+      int hour = 0;
+      int minute = 0;
+      int second = 0;
+      int nanosecond = 0;
+
+      if (!utils::parse_iso_time(
+        input,
+        position,
+        hour,
+        minute,
+        second,
+        nanosecond
+      ))
+      {
+        return errc::invalid_format;
+      }
+
+      return make(hour, minute, second, nanosecond);
     }
 
     /**
      * Returns hour of the day (from 0 to 23).
      */
-    inline int hour() const
+    constexpr int hour() const noexcept
     {
-      return m_hour;
+      return second_of_day() / 3600;
     }
 
     /**
      * Returns minute of the hour (from 0 to 59).
      */
-    inline int minute() const
+    constexpr int minute() const noexcept
     {
-      return m_minute;
+      return second_of_day() / 60 % 60;
     }
 
     /**
      * Returns second of the minute (from 0 to 59).
      */
-    inline int second() const
+    constexpr int second() const noexcept
+    {
+      return second_of_day() % 60;
+    }
+
+    /**
+     * Returns millisecond of the second (from 0 to 999).
+     */
+    constexpr int millisecond() const noexcept
+    {
+      return nanosecond() / 1000000;
+    }
+
+    /**
+     * Returns microsecond of the second (from 0 to 999 999).
+     */
+    constexpr int microsecond() const noexcept
+    {
+      return nanosecond() / 1000;
+    }
+
+    /**
+     * Returns nanosecond of the second (from 0 to 999 999 999).
+     */
+    constexpr int nanosecond() const noexcept
     {
-      return m_second;
+      return static_cast<int>(m_nanoseconds % nanoseconds_per_second);
     }
 
     /**
-     * Uses strftime() function to format the time into a string.
+     * Returns number of whole seconds since midnight (from 0 to 86399).
+     */
+    constexpr int second_of_day() const noexcept
+    {
+      return static_cast<int>(m_nanoseconds / nanoseconds_per_second);
+    }
+
+    /**
+     * Returns number of nanoseconds since midnight.
+     */
+    constexpr std::int64_t nanosecond_of_day() const noexcept
+    {
+      return m_nanoseconds;
+    }
+
+    /**
+     * Formats the time into a string using given strftime() style format
+     * specification. See `format_pattern` for supported conversion
+     * specifiers.
      */
     std::string format(const std::string& format) const
     {
-      char buffer[BUFSIZ];
-      auto tm = make_tm(*this);
+      return this->format(format_pattern(format));
+    }
 
-      if (std::strftime(buffer, BUFSIZ, format.c_str(), &tm) == 0)
-      {
-        throw std::runtime_error("strftime() failed");
-      }
+    /**
+     * Formats the time into a string using given compiled format pattern.
+     */
+    std::string format(const format_pattern& pattern) const
+    {
+      return pattern.render(format_fields());
+    }
+
+    /**
+     * Returns the time broken down into fields used by `format_pattern`.
+     */
+    format_pattern::fields format_fields() const noexcept
+    {
+      format_pattern::fields fields;
+
+      fields.hour = hour();
+      fields.minute = minute();
+      fields.second = second();
+      fields.nanosecond = nanosecond();
 
-      return buffer;
+      return fields;
     }
 
     /**
@@ -149,29 +393,35 @@ namespace peelo::chrono
      *
      * \param that Other time to copy values from
      */
-    inline time& assign(const time& that)
+    constexpr time& assign(const time& that) noexcept
     {
-      return assign(that.m_hour, that.m_minute, that.m_second);
+      m_nanoseconds = that.m_nanoseconds;
+
+      return *this;
     }
 
     /**
      * Replaces values of the time with given values.
      *
-     * \param hour   New hour of the day
-     * \param minute New minute of the hour
-     * \param second New second of the minute
+     * \param hour       New hour of the day
+     * \param minute     New minute of the hour
+     * \param second     New second of the minute
+     * \param nanosecond New nanosecond of the second
      * \throw std::invalid_argument If given values do not construct a valid
      *                              time
      */
-    time& assign(int hour, int minute, int second)
+    constexpr time& assign(
+      int hour,
+      int minute,
+      int second,
+      int nanosecond = 0
+    )
     {
-      if (!is_valid(hour, minute, second))
+      if (!is_valid(hour, minute, second, nanosecond))
       {
-        throw std::invalid_argument("invalid time value");
+        PEELO_CHRONO_THROW(std::invalid_argument("invalid time value"));
       }
-      m_hour = hour;
-      m_minute = minute;
-      m_second = second;
+      m_nanoseconds = pack(hour, minute, second, nanosecond);
 
       return *this;
     }
@@ -191,29 +441,38 @@ namespace peelo::chrono
      *
      * \param that Other time value to test equality with
      */
-    inline bool equals(const time& that) const
+    constexpr bool equals(const time& that) const noexcept
     {
-      return equals(that.m_hour, that.m_minute, that.m_second);
+      return m_nanoseconds == that.m_nanoseconds;
     }
 
     /**
      * Tests whether this time has given values.
      *
-     * \param hour   Hour of the day
-     * \param minute Minute of the hour
-     * \param second Second of the minute
-     * \return       A boolean flag indicating whether this time has given
-     *               values or not
+     * \param hour       Hour of the day
+     * \param minute     Minute of the hour
+     * \param second     Second of the minute
+     * \param nanosecond Nanosecond of the second
+     * \return           A boolean flag indicating whether this time has given
+     *                   values or not
      */
-    inline bool equals(int hour, int minute, int second) const
+    constexpr bool equals(
+      int hour,
+      int minute,
+      int second,
+      int nanosecond = 0
+    ) const noexcept
     {
-      return hour == m_hour && m_minute == minute && m_second == second;
+      return hour == this->hour()
+        && minute == this->minute()
+        && second == this->second()
+        && nanosecond == this->nanosecond();
     }
 
     /**
      * Equality testing operator.
      */
-    inline bool operator==(const time& that) const
+    constexpr bool operator==(const time& that) const noexcept
     {
       return equals(that);
     }
@@ -221,7 +480,7 @@ namespace peelo::chrono
     /**
      * Non-equality testing operator.
      */
-    inline bool operator!=(const time& that) const
+    constexpr bool operator!=(const time& that) const noexcept
     {
       return !equals(that);
     }
@@ -232,109 +491,81 @@ namespace peelo::chrono
      * \param that Other time to compare this one against
      * \return     Integer value indicating comparison result
      */
-    inline int compare(const time& that) const
+    constexpr int compare(const time& that) const noexcept
     {
-      return compare(that.m_hour, that.m_minute, that.m_second);
+      return (m_nanoseconds > that.m_nanoseconds)
+        - (m_nanoseconds < that.m_nanoseconds);
     }
 
     /**
      * Compares time against given values.
      *
-     * \param hour   Hour of the day
-     * \param minute Minute of the hour
-     * \param second Second of the minute
-     * \return       Integer value indicating comparison result
+     * \param hour       Hour of the day
+     * \param minute     Minute of the hour
+     * \param second     Second of the minute
+     * \param nanosecond Nanosecond of the second
+     * \return           Integer value indicating comparison result
      */
-    int compare(int hour, int minute, int second) const
+    constexpr int compare(
+      int hour,
+      int minute,
+      int second,
+      int nanosecond = 0
+    ) const noexcept
     {
-      if (m_hour != hour)
-      {
-        return m_hour > hour ? 1 : -1;
-      }
-      else if (m_minute != minute)
-      {
-        return m_minute > minute ? 1 : -1;
-      }
-      else if (m_second != second)
-      {
-        return m_second > second ? 1 : -1;
-      } else {
-        return 0;
-      }
+      const auto value = pack(hour, minute, second, nanosecond);
+
+      return (m_nanoseconds > value) - (m_nanoseconds < value);
     }
 
     /**
      * Comparison operator.
      */
-    inline bool operator<(const time& that) const
+    constexpr bool operator<(const time& that) const noexcept
     {
-      return compare(that) < 0;
+      return m_nanoseconds < that.m_nanoseconds;
     }
 
     /**
      * Comparison operator.
      */
-    inline bool operator>(const time& that) const
+    constexpr bool operator>(const time& that) const noexcept
     {
-      return compare(that) > 0;
+      return m_nanoseconds > that.m_nanoseconds;
     }
 
     /**
      * Comparison operator.
      */
-    inline bool operator<=(const time& that) const
+    constexpr bool operator<=(const time& that) const noexcept
     {
-      return compare(that) <= 0;
+      return m_nanoseconds <= that.m_nanoseconds;
     }
 
     /**
      * Comparison operator.
      */
-    inline bool operator>=(const time& that) const
+    constexpr bool operator>=(const time& that) const noexcept
     {
-      return compare(that) >= 0;
+      return m_nanoseconds >= that.m_nanoseconds;
     }
 
     /**
      * Increments time by one second.
      */
-    time& operator++()
+    constexpr time& operator++() noexcept
     {
-      if (++m_second >= 60)
-      {
-        m_second = 0;
-        if (++m_minute >= 60)
-        {
-          m_minute = 0;
-          if (++m_hour >= 24)
-          {
-            m_hour = 0;
-          }
-        }
-      }
-
-      return *this;
+      return *this += 1;
     }
 
     /**
      * Increments time by one second.
      */
-    time operator++(int)
+    constexpr time operator++(int) noexcept
     {
       const time return_value(*this);
 
-      if (++m_second >= 60)
-      {
-        m_second = 0;
-        if (++m_minute >= 60)
-        {
-          m_minute = 0;
-          if (++m_hour >= 24)
-          {
-            m_hour = 0;
-          }
-        }
-      }
+      *this += 1;
 
       return return_value;
     }
@@ -342,157 +573,233 @@ namespace peelo::chrono
     /**
      * Decrements time by one second.
      */
-    time& operator--()
+    constexpr time& operator--() noexcept
     {
-      if (--m_second < 0)
-      {
-        m_second = 59;
-        if (--m_minute < 0)
-        {
-          m_minute = 59;
-          if (--m_hour < 0)
-          {
-            m_hour = 23;
-          }
-        }
-      }
-
-      return *this;
+      return *this -= 1;
     }
 
     /**
      * Decrements time by one second.
      */
-    time operator--(int)
+    constexpr time operator--(int) noexcept
     {
       const time return_value(*this);
 
-      if (--m_second < 0)
-      {
-        m_second = 59;
-        if (--m_minute < 0)
-        {
-          m_minute = 59;
-          if (--m_hour < 0)
-          {
-            m_hour = 23;
-          }
-        }
-      }
+      *this -= 1;
 
       return return_value;
     }
 
     /**
-     * Adds given number of seconds to the time and returns result.
+     * Returns a copy of the time with given number of seconds added to it,
+     * wrapping around midnight.
+     *
+     * \param seconds Number of seconds to add, may be negative
+     * \param days    Receives the number of days carried over midnight, which
+     *                is negative when the result wraps backwards
+     */
+    constexpr time add_seconds(
+      std::int64_t seconds,
+      std::int64_t& days
+    ) const noexcept
+    {
+      return add(duration(seconds), days);
+    }
+
+    /**
+     * Returns a copy of the time with given duration added to it, wrapping
+     * around midnight.
+     *
+     * \param duration Duration to add, may be negative
+     * \param days     Receives the number of days carried over midnight,
+     *                 which is negative when the result wraps backwards
+     */
+    constexpr time add(
+      const class duration& duration,
+      std::int64_t& days
+    ) const noexcept
+    {
+      const auto seconds = second_of_day() + duration.seconds();
+      const auto nanoseconds = nanosecond() + duration.nanosecond();
+      const auto total = seconds + nanoseconds / nanoseconds_per_second;
+
+      days = (total >= 0 ? total : total - (seconds_per_day - 1))
+        / seconds_per_day;
+
+      return time(
+        raw_t(),
+        (total - days * seconds_per_day) * nanoseconds_per_second
+        + nanoseconds % nanoseconds_per_second
+      );
+    }
+
+    /**
+     * Adds given number of seconds to the time and returns result, wrapping
+     * around midnight.
      */
-    inline time operator+(int seconds) const
+    constexpr time operator+(int seconds) const noexcept
     {
       return time(*this) += seconds;
     }
 
     /**
-     * Substracts given number of seconds from the time and returns result.
+     * Substracts given number of seconds from the time and returns result,
+     * wrapping around midnight.
      */
-    inline time operator-(int seconds) const
+    constexpr time operator-(int seconds) const noexcept
     {
       return time(*this) -= seconds;
     }
 
     /**
-     * Adds given number of seconds to the time.
+     * Adds given number of seconds to the time, wrapping around midnight.
      */
-    time& operator+=(int seconds)
+    constexpr time& operator+=(int seconds) noexcept
     {
-      int second = ((m_hour * 60 * 60) + (m_minute * 60) + m_second) + seconds;
-      int minute;
-      int hour;
+      m_nanoseconds = wrap(
+        m_nanoseconds
+        + seconds % seconds_per_day * nanoseconds_per_second
+      );
 
-      normalize(second, minute, hour);
-      if (!is_valid(hour, minute, second))
-      {
-        throw std::invalid_argument("invalid time value");
-      }
-      m_hour = hour;
-      m_minute = minute;
-      m_second = second;
+      return *this;
+    }
+
+    /**
+     * Substracts given number of seconds from the time, wrapping around
+     * midnight.
+     */
+    constexpr time& operator-=(int seconds) noexcept
+    {
+      m_nanoseconds = wrap(
+        m_nanoseconds
+        - seconds % seconds_per_day * nanoseconds_per_second
+      );
 
       return *this;
     }
 
     /**
-     * Substracts given number of seconds from the time.
+     * Adds given duration to the time and returns result, wrapping around
+     * midnight.
      */
-    time& operator-=(int seconds)
+    constexpr time operator+(const class duration& duration) const noexcept
     {
-      int second = ((m_hour * 60 * 60) + (m_minute * 60) + m_second) - seconds;
-      int minute;
-      int hour;
+      std::int64_t days = 0;
 
-      normalize(second, minute, hour);
-      if (!is_valid(hour, minute, second))
-      {
-        throw std::invalid_argument("invalid time value");
-      }
-      m_hour = hour;
-      m_minute = minute;
-      m_second = second;
+      return add(duration, days);
+    }
 
-      return *this;
+    /**
+     * Substracts given duration from the time and returns result, wrapping
+     * around midnight.
+     */
+    constexpr time operator-(const class duration& duration) const noexcept
+    {
+      std::int64_t days = 0;
+
+      return add(-duration, days);
     }
 
-  private:
-    static void normalize(int& second, int& minute, int& hour)
+    /**
+     * Adds given duration to the time, wrapping around midnight.
+     */
+    constexpr time& operator+=(const class duration& duration) noexcept
     {
-      static const int seconds_per_minute = 60;
-      static const int seconds_per_hour = seconds_per_minute * 60;
-      static const int seconds_per_day = seconds_per_hour * 24;
+      return assign(*this + duration);
+    }
 
-      while (second > seconds_per_day)
-      {
-        second -= seconds_per_day;
-      }
-      hour = second / seconds_per_hour;
-      if (hour > 0)
-      {
-        second -= hour * seconds_per_hour;
-      }
-      minute = second / seconds_per_minute;
-      if (minute > 0)
-      {
-        second -= minute * seconds_per_minute;
-      }
+    /**
+     * Substracts given duration from the time, wrapping around midnight.
+     */
+    constexpr time& operator-=(const class duration& duration) noexcept
+    {
+      return assign(*this - duration);
     }
 
-    static std::tm make_tm(const class time& time)
+  private:
+    static constexpr std::int64_t seconds_per_day = 86400;
+    static constexpr std::int64_t nanoseconds_per_second = 1000000000;
+    static constexpr std::int64_t nanoseconds_per_day =
+      seconds_per_day * nanoseconds_per_second;
+
+    struct raw_t {};
+
+    constexpr time(raw_t, std::int64_t nanoseconds) noexcept
+      : m_nanoseconds(nanoseconds) {}
+
+    static constexpr std::int64_t pack(
+      int hour,
+      int minute,
+      int second,
+      int nanosecond
+    ) noexcept
     {
-      std::tm tm = {0};
+      return (
+        static_cast<std::int64_t>(hour * 3600 + minute * 60 + second)
+        * nanoseconds_per_second
+        + nanosecond
+      );
+    }
 
-      tm.tm_year = 90;
-      tm.tm_mon = 0;
-      tm.tm_mday = 1;
-      tm.tm_hour = time.hour();
-      tm.tm_min = time.minute();
-      tm.tm_sec = time.second();
+    static constexpr std::int64_t wrap(std::int64_t nanoseconds) noexcept
+    {
+      const auto result = nanoseconds % nanoseconds_per_day;
 
-      return tm;
+      return result < 0 ? result + nanoseconds_per_day : result;
     }
 
   private:
-    /** Hour of the day. */
-    int m_hour;
-    /** Minute of the hour. */
-    int m_minute;
-    /** Second of the minute. */
-    int m_second;
+    /** Number of nanoseconds since midnight. */
+    std::int64_t m_nanoseconds;
   };
 
+  /**
+   * Parses ISO 8601 time of day from character range `[first, last)`, as
+   * `time::parse()` does. Any text after the time is left unparsed. On failure
+   * given value is not modified.
+   *
+   * \return Pointer one past the last character parsed, or `first` and
+   *         `std::errc::invalid_argument` if the input is malformed or
+   *         `std::errc::result_out_of_range` if the values are out of range
+   */
+  constexpr std::from_chars_result from_chars(
+    const char* first,
+    const char* last,
+    class time& time
+  ) noexcept
+  {
+    return utils::from_chars(first, last, time);
+  }
+
+  /**
+   * Writes textual presentation of the time in the format used by
+   * `to_string()` into character range `[first, last)`.
+   *
+   * \return Pointer one past the last character written, or `last` and
+   *         `std::errc::value_too_large` if the range is too small
+   */
+  inline std::to_chars_result to_chars(
+    char* first,
+    char* last,
+    const class time& time
+  )
+  {
+    static const format_pattern pattern("%T");
+
+    return pattern.to_chars(first, last, time.format_fields());
+  }
+
   /**
    * Returns textual presentation of the time into the stream in RFC 2822
    * compliant format.
    */
   inline std::string to_string(const class time& time)
   {
-    return time.format("%T");
+    char buffer[time::max_string_length];
+
+    return std::string(
+      buffer,
+      to_chars(buffer, buffer + sizeof(buffer), time).ptr
+    );
   }
 }
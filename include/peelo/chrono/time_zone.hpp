@@ -0,0 +1,1116 @@
+/*
+ * Copyright (c) 2016-2024, peelo.net
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#else
+#  include <fstream>
+#  include <iterator>
+#endif
+
+#include <peelo/chrono/datetime.hpp>
+#include <peelo/chrono/instant.hpp>
+#if defined(PEELO_CHRONO_EMBEDDED_TZDB)
+#  include <peelo/chrono/embedded_tzdb.hpp>
+#endif
+
+namespace peelo::chrono
+{
+  /**
+   * Time zone which converts between UTC and local time without using the
+   * time zone of the process.
+   *
+   * Time zones are usually loaded from TZif files (RFC 8536) found in the
+   * zoneinfo directory of the system. Transitions of the zone are kept in a
+   * flat sorted array which is searched with binary search, and timestamps
+   * after the last transition are resolved with the POSIX TZ rule stored in
+   * the footer of the file. Leap second records are ignored.
+   *
+   * Each thread remembers the interval between two transitions in which the
+   * latest conversion of a zone fell, so converting timestamps which are
+   * close to each other, such as a sorted stream of log entries, skips the
+   * search.
+   */
+  class time_zone
+  {
+  public:
+    /**
+     * Local time type in effect at some point in time.
+     */
+    struct local_type
+    {
+      /** Offset from UTC in seconds, positive east of Greenwich. */
+      std::int32_t offset;
+      /** Whether daylight saving time is in effect. */
+      bool is_dst;
+      /**
+       * Abbreviation of the local time type, such as "EEST". Refers to
+       * storage owned by the time zone.
+       */
+      std::string_view abbreviation;
+    };
+
+    /**
+     * Returns time zone which is always in UTC.
+     */
+    static time_zone utc()
+    {
+      auto zone = from_posix("UTC0");
+
+      zone.m_name = "UTC";
+
+      return zone;
+    }
+
+    /**
+     * Loads time zone with given name, such as "Europe/Helsinki", from the
+     * zoneinfo directory of the system. The directory can be overridden with
+     * `TZDIR` environment variable and defaults to `/usr/share/zoneinfo`.
+     *
+     * When the library is built with `PEELO_CHRONO_EMBEDDED_TZDB` option,
+     * zones embedded into the binary are used without accessing the file
+     * system, and only other zones are loaded from the zoneinfo directory.
+     *
+     * \param name Name of the time zone
+     * \throw std::invalid_argument If given name is not a valid time zone
+     *                              name
+     * \throw std::runtime_error    If the time zone cannot be loaded
+     */
+    static time_zone locate(const std::string& name)
+    {
+      const auto directory = std::getenv("TZDIR");
+
+      if (name.empty() || name[0] == '/' || name.find("..") != name.npos)
+      {
+        PEELO_CHRONO_THROW(std::invalid_argument("invalid time zone name"));
+      }
+
+#if defined(PEELO_CHRONO_EMBEDDED_TZDB)
+      const auto embedded = std::lower_bound(
+        std::begin(embedded_tzdb::zones),
+        std::end(embedded_tzdb::zones),
+        name,
+        [](const embedded_tzdb::zone& zone, const std::string& name)
+        {
+          return zone.name < name;
+        }
+      );
+
+      if (embedded != std::end(embedded_tzdb::zones) && embedded->name == name)
+      {
+        return from_tzif(name, embedded->data, embedded->size);
+      }
+#endif
+
+      return from_file(
+        name,
+        std::string(
+          directory && *directory ? directory : "/usr/share/zoneinfo"
+        ) + '/' + name
+      );
+    }
+
+    /**
+     * Loads time zone from TZif file in given path.
+     *
+     * \param name Name of the time zone
+     * \param path Path of the TZif file
+     * \throw std::runtime_error If the file cannot be read or it does not
+     *                           contain valid TZif data
+     */
+    static time_zone from_file(
+      const std::string& name,
+      const std::string& path
+    )
+    {
+#if defined(__unix__) || defined(__APPLE__)
+      struct mapping
+      {
+        void* data;
+        std::size_t size;
+
+        ~mapping()
+        {
+          ::munmap(data, size);
+        }
+      };
+      struct ::stat info;
+      const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+      if (fd < 0)
+      {
+        PEELO_CHRONO_THROW(std::runtime_error("unable to open time zone"));
+      }
+      else if (::fstat(fd, &info) != 0 || info.st_size <= 0)
+      {
+        ::close(fd);
+        PEELO_CHRONO_THROW(std::runtime_error("unable to read time zone"));
+      }
+
+      const auto size = static_cast<std::size_t>(info.st_size);
+      const auto data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+      ::close(fd);
+      if (data == MAP_FAILED)
+      {
+        PEELO_CHRONO_THROW(std::runtime_error("unable to read time zone"));
+      }
+
+      const mapping guard = { data, size };
+
+      return from_tzif(
+        name,
+        static_cast<const unsigned char*>(guard.data),
+        guard.size
+      );
+#else
+      std::ifstream file(path, std::ios::binary);
+
+      if (!file)
+      {
+        PEELO_CHRONO_THROW(std::runtime_error("unable to open time zone"));
+      }
+
+      const std::vector<char> buffer(
+        (std::istreambuf_iterator<char>(file)),
+        std::istreambuf_iterator<char>()
+      );
+
+      return from_tzif(
+        name,
+        reinterpret_cast<const unsigned char*>(buffer.data()),
+        buffer.size()
+      );
+#endif
+    }
+
+    /**
+     * Constructs time zone from TZif data in memory. Both version 1 data and
+     * the 64-bit data of version 2 and later files are supported.
+     *
+     * \param name Name of the time zone
+     * \param data Pointer to the TZif data
+     * \param size Size of the TZif data in bytes
+     * \throw std::runtime_error    If given data is not valid TZif data
+     * \throw std::invalid_argument If the footer of the data contains an
+     *                              invalid POSIX TZ rule
+     */
+    static time_zone from_tzif(
+      const std::string& name,
+      const unsigned char* data,
+      std::size_t size
+    )
+    {
+      time_zone zone(name);
+      std::size_t position = 0;
+      auto header = read_header(data, size, position);
+
+      if (header.version >= '2')
+      {
+        position += block_size(header, 4);
+        header = read_header(data, size, position);
+        zone.read_block(header, 8, data, size, position);
+        zone.read_footer(data, size, position);
+      } else {
+        zone.read_block(header, 4, data, size, position);
+      }
+
+      return zone;
+    }
+
+    /**
+     * Constructs time zone from POSIX TZ rule, such as
+     * "EST5EDT,M3.2.0,M11.1.0". When daylight saving time is specified
+     * without rules for it, the rules of the United States are used.
+     *
+     * \param rule POSIX TZ rule, which is also used as name of the zone
+     * \throw std::invalid_argument If given rule is not valid
+     */
+    static time_zone from_posix(const std::string& rule)
+    {
+      time_zone zone(rule);
+
+      zone.parse_posix(rule);
+
+      return zone;
+    }
+
+    /**
+     * Returns the name of the time zone.
+     */
+    const std::string& name() const noexcept
+    {
+      return m_name;
+    }
+
+    /**
+     * Returns the local time type in effect at given UNIX timestamp.
+     *
+     * \param timestamp Number of seconds since UNIX epoch
+     */
+    local_type lookup(std::int64_t timestamp) const noexcept
+    {
+      const auto& type = m_types[type_index(timestamp)];
+
+      return {
+        type.offset,
+        type.is_dst,
+        std::string_view(
+          m_abbreviations.data() + type.abbreviation,
+          type.abbreviation_length
+        )
+      };
+    }
+
+    /**
+     * Returns offset from UTC in seconds, positive east of Greenwich, which
+     * is in effect at given UNIX timestamp.
+     *
+     * \param timestamp Number of seconds since UNIX epoch
+     */
+    std::int32_t offset(std::int64_t timestamp) const noexcept
+    {
+      return m_types[type_index(timestamp)].offset;
+    }
+
+    /**
+     * Converts date and time in UTC into local time of the zone.
+     */
+    datetime to_local(const datetime& utc) const noexcept
+    {
+      return utc + duration(offset(utc.timestamp()));
+    }
+
+    /**
+     * Converts instant into local time of the zone.
+     */
+    datetime to_local(const instant& instant) const noexcept
+    {
+      return to_local(instant.datetime());
+    }
+
+    /**
+     * Converts local date and time of the zone into UTC. When the local time
+     * occurs twice, for example when daylight saving time ends, the earlier
+     * one is used. When the local time does not exist, for example when
+     * daylight saving time starts, it is shifted forward by the length of the
+     * gap.
+     */
+    datetime to_utc(const datetime& local) const noexcept
+    {
+      return local - duration(local_offset(local.timestamp()));
+    }
+
+    /**
+     * Serializes the time zone into TZif version 2 data, which can be loaded
+     * back with `from_tzif()`. Only transitions within given range are
+     * included, and the local time type in effect at the beginning of the
+     * range is also used for timestamps before it. The POSIX TZ rule of the
+     * zone is stored in the footer.
+     *
+     * \param first Beginning of the range as UNIX timestamp, inclusive
+     * \param last  End of the range as UNIX timestamp, exclusive
+     */
+    std::vector<unsigned char> to_tzif(
+      std::int64_t first = std::numeric_limits<std::int64_t>::min(),
+      std::int64_t last = std::numeric_limits<std::int64_t>::max()
+    ) const
+    {
+      const auto begin = std::lower_bound(
+        std::begin(m_transitions),
+        std::end(m_transitions),
+        first
+      );
+      const auto end = std::lower_bound(begin, std::end(m_transitions), last);
+      std::vector<std::size_t> types = { type_index(first) };
+      std::vector<unsigned char> indexes;
+      std::string abbreviations;
+      std::vector<unsigned char> result;
+
+      for (auto it = begin; it != end; ++it)
+      {
+        const auto type = m_transition_types[it - std::begin(m_transitions)];
+        const auto position = std::find(
+          std::begin(types),
+          std::end(types),
+          type
+        );
+
+        indexes.push_back(
+          static_cast<unsigned char>(position - std::begin(types))
+        );
+        if (position == std::end(types))
+        {
+          types.push_back(type);
+        }
+      }
+
+      write_header(result, 0, 1, 1);
+      result.insert(std::end(result), 7, 0);
+      write_header(
+        result,
+        static_cast<std::uint32_t>(indexes.size()),
+        static_cast<std::uint32_t>(types.size()),
+        0
+      );
+
+      const auto charcnt_position = result.size() - 4;
+
+      for (auto it = begin; it != end; ++it)
+      {
+        write_be32(result, static_cast<std::uint32_t>(
+          static_cast<std::uint64_t>(*it) >> 32
+        ));
+        write_be32(result, static_cast<std::uint32_t>(*it));
+      }
+      result.insert(std::end(result), std::begin(indexes), std::end(indexes));
+      for (const auto index : types)
+      {
+        const auto& type = m_types[index];
+        const auto abbreviation = m_abbreviations.substr(
+          type.abbreviation,
+          type.abbreviation_length + 1
+        );
+        auto position = abbreviations.find(abbreviation);
+
+        if (position == abbreviations.npos)
+        {
+          position = abbreviations.length();
+          abbreviations.append(abbreviation);
+        }
+        write_be32(result, static_cast<std::uint32_t>(type.offset));
+        result.push_back(type.is_dst);
+        result.push_back(static_cast<unsigned char>(position));
+      }
+      result.insert(
+        std::end(result),
+        std::begin(abbreviations),
+        std::end(abbreviations)
+      );
+      for (int i = 0; i < 4; ++i)
+      {
+        result[charcnt_position + i] = static_cast<unsigned char>(
+          abbreviations.length() >> (24 - i * 8)
+        );
+      }
+      result.push_back('\n');
+      result.insert(std::end(result), std::begin(m_posix), std::end(m_posix));
+      result.push_back('\n');
+
+      return result;
+    }
+
+  private:
+    static constexpr std::int64_t seconds_per_day = 86400;
+    /**
+     * Limit of timestamps, in both directions, up to which the POSIX TZ rule
+     * is expanded, which is roughly 31 million years from the epoch. Beyond
+     * it, the local time type in effect at the limit is used, which keeps
+     * the rule arithmetic far away from overflowing.
+     */
+    static constexpr std::int64_t rule_limit = 1000000000000000;
+
+    struct tzif_header
+    {
+      char version;
+      std::uint32_t isutcnt;
+      std::uint32_t isstdcnt;
+      std::uint32_t leapcnt;
+      std::uint32_t timecnt;
+      std::uint32_t typecnt;
+      std::uint32_t charcnt;
+    };
+
+    struct type_entry
+    {
+      std::int32_t offset;
+      bool is_dst;
+      std::size_t abbreviation;
+      std::size_t abbreviation_length;
+    };
+
+    struct rule_date
+    {
+      /** 'J' for Julian day, 'N' for zero based day or 'M' for month rule. */
+      char kind;
+      int month;
+      int week;
+      int day;
+      /** Local time of the transition, in seconds since midnight. */
+      std::int32_t time;
+    };
+
+    struct rule
+    {
+      bool present;
+      bool has_dst;
+      std::size_t std_type;
+      std::size_t dst_type;
+      rule_date start;
+      rule_date end;
+    };
+
+    struct interval
+    {
+      /** UTC timestamp where the interval begins, inclusive. */
+      std::int64_t start;
+      /** UTC timestamp where the interval ends, exclusive. */
+      std::int64_t end;
+      /** Index of the local time type in effect during the interval. */
+      std::size_t type;
+    };
+
+    struct cache_entry
+    {
+      /** Identifier of the zone which the entry belongs to. */
+      std::uint64_t zone;
+      /** Interval of the latest conversion made with the zone. */
+      interval value;
+    };
+
+    static constexpr std::size_t cache_size = 8;
+
+    explicit time_zone(const std::string& name)
+      : m_id(next_id())
+      , m_name(name)
+      , m_rule() {}
+
+    static std::uint64_t next_id() noexcept
+    {
+      static std::atomic<std::uint64_t> counter(0);
+
+      return ++counter;
+    }
+
+    static cache_entry* cache() noexcept
+    {
+      static thread_local cache_entry entries[cache_size] = {};
+
+      return entries;
+    }
+
+    std::size_t type_index(std::int64_t timestamp) const noexcept
+    {
+      auto& entry = cache()[m_id % cache_size];
+
+      if (entry.zone != m_id
+          || timestamp < entry.value.start
+          || timestamp >= entry.value.end)
+      {
+        entry.zone = m_id;
+        entry.value = find_interval(timestamp);
+      }
+
+      return entry.value.type;
+    }
+
+    interval find_interval(std::int64_t timestamp) const noexcept
+    {
+      if (m_transitions.empty() || timestamp >= m_transitions.back())
+      {
+        const auto start = m_transitions.empty()
+          ? std::numeric_limits<std::int64_t>::min()
+          : m_transitions.back();
+
+        if (m_rule.present)
+        {
+          return rule_interval(timestamp, start);
+        }
+
+        return {
+          start,
+          std::numeric_limits<std::int64_t>::max(),
+          static_cast<std::size_t>(
+            m_transitions.empty() ? 0 : m_transition_types.back()
+          )
+        };
+      }
+
+      const auto it = std::upper_bound(
+        std::begin(m_transitions),
+        std::end(m_transitions),
+        timestamp
+      );
+
+      if (it == std::begin(m_transitions))
+      {
+        return { std::numeric_limits<std::int64_t>::min(), *it, 0 };
+      }
+
+      return {
+        *(it - 1),
+        *it,
+        m_transition_types[it - std::begin(m_transitions) - 1]
+      };
+    }
+
+    interval rule_interval(
+      std::int64_t timestamp,
+      std::int64_t start
+    ) const noexcept
+    {
+      interval result = {
+        start,
+        std::numeric_limits<std::int64_t>::max(),
+        rule_type_index(timestamp)
+      };
+
+      if (!m_rule.has_dst)
+      {
+        return result;
+      }
+      else if (timestamp >= rule_limit)
+      {
+        result.start = std::max(start, rule_limit);
+
+        return result;
+      }
+      else if (timestamp < -rule_limit)
+      {
+        result.end = -rule_limit;
+
+        return result;
+      }
+
+      const auto std_offset = m_types[m_rule.std_type].offset;
+      const auto dst_offset = m_types[m_rule.dst_type].offset;
+      const auto year = rule_year(timestamp);
+
+      for (auto y = year - 1; y <= year + 1; ++y)
+      {
+        const std::int64_t boundaries[] =
+        {
+          rule_timestamp(m_rule.start, y) - std_offset,
+          rule_timestamp(m_rule.end, y) - dst_offset
+        };
+
+        for (const auto boundary : boundaries)
+        {
+          if (boundary <= timestamp)
+          {
+            result.start = std::max(result.start, boundary);
+          } else {
+            result.end = std::min(result.end, boundary);
+          }
+        }
+      }
+
+      return result;
+    }
+
+    std::int64_t rule_year(std::int64_t timestamp) const noexcept
+    {
+      const auto local = timestamp + m_types[m_rule.std_type].offset;
+      const auto days = local / seconds_per_day
+        - (local % seconds_per_day < 0);
+
+      return utils::civil_from_days(days).year;
+    }
+
+    std::size_t rule_type_index(std::int64_t timestamp) const noexcept
+    {
+      if (!m_rule.has_dst)
+      {
+        return m_rule.std_type;
+      }
+
+      timestamp = std::clamp(timestamp, -rule_limit, rule_limit);
+
+      const auto std_offset = m_types[m_rule.std_type].offset;
+      const auto dst_offset = m_types[m_rule.dst_type].offset;
+      const auto year = rule_year(timestamp);
+      const auto start = rule_timestamp(m_rule.start, year) - std_offset;
+      const auto end = rule_timestamp(m_rule.end, year) - dst_offset;
+      const bool is_dst = start < end
+        ? timestamp >= start && timestamp < end
+        : timestamp < end || timestamp >= start;
+
+      return is_dst ? m_rule.dst_type : m_rule.std_type;
+    }
+
+    static std::int64_t rule_timestamp(
+      const rule_date& date,
+      std::int64_t year
+    ) noexcept
+    {
+      const auto january = utils::days_from_civil(year, 1, 1);
+      std::int64_t day;
+
+      if (date.kind == 'J')
+      {
+        const bool leap = utils::days_from_civil(year + 1, 1, 1) - january
+          == 366;
+
+        day = january + date.day - 1 + (leap && date.day >= 60);
+      }
+      else if (date.kind == 'N')
+      {
+        day = january + date.day;
+      } else {
+        const auto first = utils::days_from_civil(year, date.month, 1);
+        const auto next = date.month == 12
+          ? utils::days_from_civil(year + 1, 1, 1)
+          : utils::days_from_civil(year, date.month + 1, 1);
+        auto offset = (date.day - utils::weekday_from_days(first) + 7) % 7
+          + (date.week - 1) * 7;
+
+        while (first + offset >= next)
+        {
+          offset -= 7;
+        }
+        day = first + offset;
+      }
+
+      return day * seconds_per_day + date.time;
+    }
+
+    std::int32_t local_offset(std::int64_t local) const noexcept
+    {
+      const auto& entry = cache()[m_id % cache_size];
+
+      // When the cached interval contains the result with at least a day of
+      // margin on both sides, the local time cannot be ambiguous as offsets
+      // never change by a day or more.
+      if (entry.zone == m_id)
+      {
+        const auto offset = m_types[entry.value.type].offset;
+        const auto utc = local - offset;
+
+        if (utc - seconds_per_day >= entry.value.start
+            && utc + seconds_per_day < entry.value.end)
+        {
+          return offset;
+        }
+      }
+
+      const auto before = offset(local - seconds_per_day);
+      const auto after = offset(local + seconds_per_day);
+
+      if (offset(local - before) == before)
+      {
+        return before;
+      }
+      else if (offset(local - after) == after)
+      {
+        return after;
+      }
+
+      return before;
+    }
+
+    static std::uint32_t read_be32(const unsigned char* data) noexcept
+    {
+      return static_cast<std::uint32_t>(data[0]) << 24
+        | static_cast<std::uint32_t>(data[1]) << 16
+        | static_cast<std::uint32_t>(data[2]) << 8
+        | static_cast<std::uint32_t>(data[3]);
+    }
+
+    static std::uint64_t read_be64(const unsigned char* data) noexcept
+    {
+      return static_cast<std::uint64_t>(read_be32(data)) << 32
+        | read_be32(data + 4);
+    }
+
+    static tzif_header read_header(
+      const unsigned char* data,
+      std::size_t size,
+      std::size_t& position
+    )
+    {
+      tzif_header result;
+
+      if (size < 44 || position > size - 44 || data[position] != 'T'
+          || data[position + 1] != 'Z' || data[position + 2] != 'i'
+          || data[position + 3] != 'f')
+      {
+        PEELO_CHRONO_THROW(std::runtime_error("invalid TZif data"));
+      }
+      result.version = static_cast<char>(data[position + 4]);
+      result.isutcnt = read_be32(data + position + 20);
+      result.isstdcnt = read_be32(data + position + 24);
+      result.leapcnt = read_be32(data + position + 28);
+      result.timecnt = read_be32(data + position + 32);
+      result.typecnt = read_be32(data + position + 36);
+      result.charcnt = read_be32(data + position + 40);
+      position += 44;
+      if (result.typecnt == 0 || result.typecnt > 256 || result.charcnt == 0)
+      {
+        PEELO_CHRONO_THROW(std::runtime_error("invalid TZif data"));
+      }
+
+      return result;
+    }
+
+    static void write_be32(
+      std::vector<unsigned char>& output,
+      std::uint32_t value
+    )
+    {
+      for (int shift = 24; shift >= 0; shift -= 8)
+      {
+        output.push_back(static_cast<unsigned char>(value >> shift));
+      }
+    }
+
+    static void write_header(
+      std::vector<unsigned char>& output,
+      std::uint32_t timecnt,
+      std::uint32_t typecnt,
+      std::uint32_t charcnt
+    )
+    {
+      output.insert(std::end(output), { 'T', 'Z', 'i', 'f', '2' });
+      output.insert(std::end(output), 27, 0);
+      write_be32(output, timecnt);
+      write_be32(output, typecnt);
+      write_be32(output, charcnt);
+    }
+
+    static std::uint64_t block_size(
+      const tzif_header& h,
+      std::size_t time_size
+    )
+    {
+      return static_cast<std::uint64_t>(h.timecnt) * (time_size + 1)
+        + static_cast<std::uint64_t>(h.typecnt) * 6
+        + h.charcnt
+        + static_cast<std::uint64_t>(h.leapcnt) * (time_size + 4)
+        + h.isstdcnt
+        + h.isutcnt;
+    }
+
+    void read_block(
+      const tzif_header& h,
+      std::size_t time_size,
+      const unsigned char* data,
+      std::size_t size,
+      std::size_t& position
+    )
+    {
+      if (block_size(h, time_size) > size - position)
+      {
+        PEELO_CHRONO_THROW(std::runtime_error("invalid TZif data"));
+      }
+
+      const auto times = data + position;
+      const auto indexes = times + h.timecnt * time_size;
+      const auto types = indexes + h.timecnt;
+      const auto chars = types + h.typecnt * 6;
+
+      m_transitions.reserve(h.timecnt);
+      m_transition_types.reserve(h.timecnt);
+      for (std::uint32_t i = 0; i < h.timecnt; ++i)
+      {
+        const auto time = time_size == 8
+          ? static_cast<std::int64_t>(read_be64(times + i * 8))
+          : static_cast<std::int32_t>(read_be32(times + i * 4));
+
+        if (indexes[i] >= h.typecnt
+            || (i > 0 && time <= m_transitions.back()))
+        {
+          PEELO_CHRONO_THROW(std::runtime_error("invalid TZif data"));
+        }
+        m_transitions.push_back(time);
+        m_transition_types.push_back(indexes[i]);
+      }
+
+      m_abbreviations.assign(
+        reinterpret_cast<const char*>(chars),
+        h.charcnt
+      );
+      m_types.reserve(h.typecnt);
+      for (std::uint32_t i = 0; i < h.typecnt; ++i)
+      {
+        const auto type = types + i * 6;
+        const std::size_t abbreviation = type[5];
+
+        if (abbreviation >= h.charcnt)
+        {
+          PEELO_CHRONO_THROW(std::runtime_error("invalid TZif data"));
+        }
+        m_types.push_back({
+          static_cast<std::int32_t>(read_be32(type)),
+          type[4] != 0,
+          abbreviation,
+          std::string_view(m_abbreviations.c_str() + abbreviation).length()
+        });
+      }
+      position += block_size(h, time_size);
+    }
+
+    void read_footer(
+      const unsigned char* data,
+      std::size_t size,
+      std::size_t& position
+    )
+    {
+      const auto begin = reinterpret_cast<const char*>(data) + position;
+      const auto end = reinterpret_cast<const char*>(data) + size;
+
+      if (begin == end || *begin != '\n')
+      {
+        PEELO_CHRONO_THROW(std::runtime_error("invalid TZif data"));
+      }
+
+      const auto newline = std::find(begin + 1, end, '\n');
+
+      if (newline == end)
+      {
+        PEELO_CHRONO_THROW(std::runtime_error("invalid TZif data"));
+      }
+      else if (newline != begin + 1)
+      {
+        parse_posix(std::string(begin + 1, newline));
+      }
+    }
+
+    std::size_t add_type(
+      std::int32_t offset,
+      bool is_dst,
+      const std::string& abbreviation
+    )
+    {
+      m_types.push_back({
+        offset,
+        is_dst,
+        m_abbreviations.length(),
+        abbreviation.length()
+      });
+      m_abbreviations.append(abbreviation);
+      m_abbreviations.push_back('\0');
+
+      return m_types.size() - 1;
+    }
+
+    void parse_posix(const std::string& input)
+    {
+      std::size_t position = 0;
+
+      m_posix = input;
+      const auto std_name = parse_posix_name(input, position);
+      const auto std_offset = -parse_posix_time(input, position, 24);
+
+      m_rule.present = true;
+      m_rule.std_type = add_type(std_offset, false, std_name);
+      if (position == input.length())
+      {
+        return;
+      }
+
+      const auto dst_name = parse_posix_name(input, position);
+      auto dst_offset = std_offset + 3600;
+
+      if (position < input.length() && input[position] != ',')
+      {
+        dst_offset = -parse_posix_time(input, position, 24);
+      }
+      m_rule.has_dst = true;
+      m_rule.dst_type = add_type(dst_offset, true, dst_name);
+      if (position == input.length())
+      {
+        m_rule.start = { 'M', 3, 2, 0, 7200 };
+        m_rule.end = { 'M', 11, 1, 0, 7200 };
+        return;
+      }
+      m_rule.start = parse_posix_date(input, position);
+      m_rule.end = parse_posix_date(input, position);
+      if (position != input.length())
+      {
+        invalid_posix();
+      }
+    }
+
+    [[noreturn]] static void invalid_posix()
+    {
+      PEELO_CHRONO_THROW(
+        std::invalid_argument("invalid POSIX time zone rule")
+      );
+    }
+
+    static int parse_posix_number(
+      const std::string& input,
+      std::size_t& position,
+      int min,
+      int max
+    )
+    {
+      int value = 0;
+      const auto start = position;
+
+      while (position < input.length()
+             && input[position] >= '0'
+             && input[position] <= '9'
+             && position - start < 3)
+      {
+        value = value * 10 + (input[position++] - '0');
+      }
+      if (position == start || value < min || value > max)
+      {
+        invalid_posix();
+      }
+
+      return value;
+    }
+
+    static std::string parse_posix_name(
+      const std::string& input,
+      std::size_t& position
+    )
+    {
+      std::string name;
+
+      if (position < input.length() && input[position] == '<')
+      {
+        const auto end = input.find('>', position);
+
+        if (end == input.npos)
+        {
+          invalid_posix();
+        }
+        name = input.substr(position + 1, end - position - 1);
+        position = end + 1;
+      } else {
+        while (position < input.length()
+               && ((input[position] >= 'A' && input[position] <= 'Z')
+                 || (input[position] >= 'a' && input[position] <= 'z')))
+        {
+          name += input[position++];
+        }
+      }
+      if (name.length() < 3)
+      {
+        invalid_posix();
+      }
+
+      return name;
+    }
+
+    static std::int32_t parse_posix_time(
+      const std::string& input,
+      std::size_t& position,
+      int max_hours
+    )
+    {
+      int sign = 1;
+      std::int32_t result;
+
+      if (position < input.length()
+          && (input[position] == '+' || input[position] == '-'))
+      {
+        sign = input[position++] == '-' ? -1 : 1;
+      }
+      result = parse_posix_number(input, position, 0, max_hours) * 3600;
+      if (position < input.length() && input[position] == ':')
+      {
+        ++position;
+        result += parse_posix_number(input, position, 0, 59) * 60;
+        if (position < input.length() && input[position] == ':')
+        {
+          ++position;
+          result += parse_posix_number(input, position, 0, 59);
+        }
+      }
+
+      return sign * result;
+    }
+
+    static rule_date parse_posix_date(
+      const std::string& input,
+      std::size_t& position
+    )
+    {
+      rule_date result = { 'N', 0, 0, 0, 7200 };
+
+      if (position >= input.length() || input[position++] != ',')
+      {
+        invalid_posix();
+      }
+      if (position < input.length() && input[position] == 'J')
+      {
+        ++position;
+        result.kind = 'J';
+        result.day = parse_posix_number(input, position, 1, 365);
+      }
+      else if (position < input.length() && input[position] == 'M')
+      {
+        ++position;
+        result.kind = 'M';
+        result.month = parse_posix_number(input, position, 1, 12);
+        if (position >= input.length() || input[position++] != '.')
+        {
+          invalid_posix();
+        }
+        result.week = parse_posix_number(input, position, 1, 5);
+        if (position >= input.length() || input[position++] != '.')
+        {
+          invalid_posix();
+        }
+        result.day = parse_posix_number(input, position, 0, 6);
+      } else {
+        result.day = parse_posix_number(input, position, 0, 365);
+      }
+      if (position < input.length() && input[position] == '/')
+      {
+        ++position;
+        result.time = parse_posix_time(input, position, 167);
+      }
+
+      return result;
+    }
+
+  private:
+    /** Identifier of the zone in conversion caches. */
+    std::uint64_t m_id;
+    /** Name of the time zone. */
+    std::string m_name;
+    /** Sorted UTC timestamps of the transitions. */
+    std::vector<std::int64_t> m_transitions;
+    /** Index of the local time type for each transition. */
+    std::vector<std::uint8_t> m_transition_types;
+    /** Local time types of the zone. */
+    std::vector<type_entry> m_types;
+    /** NUL separated abbreviations of the local time types. */
+    std::string m_abbreviations;
+    /** POSIX TZ rule for timestamps after the last transition. */
+    rule m_rule;
+    /** POSIX TZ rule of the zone in textual form. */
+    std::string m_posix;
+  };
+}
@@ -0,0 +1,447 @@
+/*
+ * Copyright (c) 2016-2024, peelo.net
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <peelo/chrono/time_zone.hpp>
+
+namespace peelo::chrono
+{
+  /**
+   * Registry which loads each time zone only once and shares it between
+   * threads.
+   *
+   * Loaded zones are published in an immutable table which is swapped with
+   * an atomic pointer, so looking up an already loaded zone never takes a
+   * lock. Loading a new zone or reloading the existing ones takes a lock
+   * which is only shared with other writers.
+   *
+   * Each published table has a generation number. Every thread which looks
+   * up zones owns a reader slot of its own, in which it records the
+   * generation current at its latest lookup, so lookups never write into
+   * memory shared with other threads once the generation has been
+   * recorded. Tables and zones replaced by `reload()` are freed by writers
+   * once no reader slot records a generation old enough to use them.
+   *
+   * As a consequence, a zone returned by the registry stays valid until the
+   * same thread looks up a zone from the registry again after a reload, or
+   * exits. Threads which have stopped looking up zones keep the tables of
+   * their latest lookup alive until then.
+   */
+  class time_zone_registry
+  {
+  public:
+    /**
+     * Function used for loading time zones by their name.
+     */
+    using loader_type = std::function<time_zone(const std::string&)>;
+
+    /**
+     * Constructs registry which loads time zones with given function.
+     *
+     * \param loader Function used for loading time zones, which defaults to
+     *               `time_zone::locate()`
+     */
+    explicit time_zone_registry(loader_type loader = time_zone::locate)
+      : m_loader(std::move(loader))
+      , m_table(nullptr)
+      , m_generation(0)
+      , m_slots(std::make_shared<slot_list>())
+    {
+      publish(std::make_unique<table>());
+    }
+
+    time_zone_registry(const time_zone_registry&) = delete;
+    time_zone_registry(time_zone_registry&&) = delete;
+    void operator=(const time_zone_registry&) = delete;
+    void operator=(time_zone_registry&&) = delete;
+
+    /**
+     * Destructor. Reader slots are returned by threads when they look up
+     * zones from some registry next time or exit.
+     */
+    ~time_zone_registry()
+    {
+      m_slots->closed.store(true, std::memory_order_release);
+    }
+
+    /**
+     * Returns the process wide registry which loads time zones from the
+     * zoneinfo directory of the system.
+     */
+    static time_zone_registry& instance()
+    {
+      static time_zone_registry registry;
+
+      return registry;
+    }
+
+    /**
+     * Returns time zone with given name, loading it when it has not been
+     * loaded yet. Does not take a lock when the zone has already been
+     * loaded.
+     *
+     * \param name Name of the time zone
+     * \throw std::invalid_argument If given name is not a valid time zone
+     *                              name
+     * \throw std::runtime_error    If the time zone cannot be loaded
+     */
+    const time_zone& locate(const std::string& name)
+    {
+      if (const auto zone = find(name))
+      {
+        return *zone;
+      }
+
+      std::lock_guard<std::mutex> lock(m_mutex);
+
+      if (const auto zone = find(name))
+      {
+        return *zone;
+      }
+
+      auto zone = std::make_shared<const time_zone>(m_loader(name));
+      const auto& current = *m_table.load(std::memory_order_acquire);
+      auto next = std::make_unique<table>(current);
+      const auto position = std::lower_bound(
+        std::begin(next->entries),
+        std::end(next->entries),
+        name,
+        compare_name
+      );
+
+      next->entries.emplace(position, name, zone);
+      publish(std::move(next));
+
+      return *zone;
+    }
+
+    /**
+     * Returns time zone with given name if it has already been loaded, or
+     * null pointer otherwise. Never takes a lock.
+     *
+     * \param name Name of the time zone
+     * \throw std::bad_alloc If the first lookup of the calling thread cannot
+     *                       allocate a reader slot
+     */
+    const time_zone* find(const std::string& name) const
+    {
+      const auto& current = pin();
+      const auto position = std::lower_bound(
+        std::begin(current.entries),
+        std::end(current.entries),
+        name,
+        compare_name
+      );
+
+      if (position == std::end(current.entries) || position->first != name)
+      {
+        return nullptr;
+      }
+
+      return position->second.get();
+    }
+
+    /**
+     * Returns the number of loaded time zones.
+     *
+     * \throw std::bad_alloc If the first lookup of the calling thread cannot
+     *                       allocate a reader slot
+     */
+    std::size_t size() const
+    {
+      return pin().entries.size();
+    }
+
+    /**
+     * Loads every time zone in the registry again, for example after the
+     * time zone database of the system has been updated. Lookups made after
+     * this call return the reloaded zones. When loading any of the zones
+     * fails, the registry is left unchanged.
+     *
+     * \throw std::runtime_error If some time zone cannot be loaded
+     */
+    void reload()
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      const auto& current = *m_table.load(std::memory_order_acquire);
+      auto next = std::make_unique<table>();
+
+      next->entries.reserve(current.entries.size());
+      for (const auto& entry : current.entries)
+      {
+        next->entries.emplace_back(
+          entry.first,
+          std::make_shared<const time_zone>(m_loader(entry.first))
+        );
+      }
+      publish(std::move(next));
+    }
+
+  private:
+    struct table
+    {
+      /** Generation of the table, starting from one. */
+      std::uint64_t generation = 0;
+      /**
+       * Loaded time zones, sorted by their name. Zones are shared between
+       * tables of consecutive generations until they are reloaded.
+       */
+      std::vector<
+        std::pair<std::string, std::shared_ptr<const time_zone>>
+      > entries;
+    };
+
+    /**
+     * Reader slot owned by a single thread, aligned to a cache line of its
+     * own so that threads never write into the same cache line.
+     */
+    struct alignas(64) reader_slot
+    {
+      /** Generation of the latest lookup, or zero when not in use. */
+      std::atomic<std::uint64_t> generation{0};
+      /** Whether some thread owns the slot. */
+      std::atomic<bool> owned{true};
+      /** Next slot in the list. */
+      reader_slot* next = nullptr;
+    };
+
+    /**
+     * List of reader slots, shared between the registry and the threads
+     * which own slots in it, so that it outlives both.
+     */
+    struct slot_list
+    {
+      std::atomic<reader_slot*> head{nullptr};
+      /** Whether the registry has been destroyed. */
+      std::atomic<bool> closed{false};
+
+      ~slot_list()
+      {
+        for (auto slot = head.load(); slot;)
+        {
+          const auto next = slot->next;
+
+          delete slot;
+          slot = next;
+        }
+      }
+
+      reader_slot* acquire()
+      {
+        for (auto slot = head.load(std::memory_order_acquire); slot;
+             slot = slot->next)
+        {
+          bool owned = false;
+
+          if (slot->owned.compare_exchange_strong(owned, true))
+          {
+            return slot;
+          }
+        }
+
+        const auto slot = new reader_slot();
+
+        slot->next = head.load(std::memory_order_relaxed);
+        while (!head.compare_exchange_weak(slot->next, slot))
+        {
+        }
+
+        return slot;
+      }
+    };
+
+    /**
+     * Reader slots owned by the current thread, returned when the thread
+     * exits.
+     */
+    struct thread_slots
+    {
+      std::vector<
+        std::pair<std::shared_ptr<slot_list>, reader_slot*>
+      > entries;
+
+      ~thread_slots()
+      {
+        for (const auto& entry : entries)
+        {
+          release(entry.second);
+        }
+      }
+
+      static void release(reader_slot* slot) noexcept
+      {
+        slot->generation.store(0, std::memory_order_release);
+        slot->owned.store(false, std::memory_order_release);
+      }
+    };
+
+    static bool compare_name(
+      const std::pair<std::string, std::shared_ptr<const time_zone>>& entry,
+      const std::string& name
+    ) noexcept
+    {
+      return entry.first < name;
+    }
+
+    /**
+     * Returns reader slot of the current thread, acquiring one when the
+     * thread looks up zones from this registry for the first time.
+     */
+    reader_slot& thread_slot() const
+    {
+      static thread_local thread_slots slots;
+      auto& entries = slots.entries;
+
+      for (const auto& entry : entries)
+      {
+        if (entry.first == m_slots)
+        {
+          return *entry.second;
+        }
+      }
+
+      entries.erase(
+        std::remove_if(
+          std::begin(entries),
+          std::end(entries),
+          [](const auto& entry)
+          {
+            return entry.first->closed.load(std::memory_order_acquire);
+          }
+        ),
+        std::end(entries)
+      );
+      entries.emplace_back(m_slots, nullptr);
+      try
+      {
+        entries.back().second = m_slots->acquire();
+      }
+      catch (...)
+      {
+        entries.pop_back();
+        throw;
+      }
+
+      return *entries.back().second;
+    }
+
+    /**
+     * Records the current generation in the reader slot of the current
+     * thread and returns the current table, which stays alive until the
+     * thread records a newer generation.
+     *
+     * A writer publishes a table before reading the slots, and a reader
+     * records the generation before loading the table, with a full fence
+     * in between on both sides. Either the writer sees the recorded
+     * generation, or the reader sees the table published by the writer,
+     * which the writer does not free. The fence is only needed when the
+     * recorded generation changes.
+     */
+    const table& pin() const
+    {
+      auto& slot = thread_slot();
+      const auto generation = m_generation.load(std::memory_order_acquire);
+
+      if (slot.generation.load(std::memory_order_relaxed) != generation)
+      {
+        slot.generation.store(generation, std::memory_order_release);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+      }
+
+      return *m_table.load(std::memory_order_acquire);
+    }
+
+    /**
+     * Publishes given table and frees the replaced tables older than the
+     * oldest generation recorded in the reader slots. Must be called while
+     * holding the lock, except from the constructor.
+     */
+    void publish(std::unique_ptr<table> next)
+    {
+      const auto generation = m_generation.load(std::memory_order_relaxed)
+        + 1;
+
+      next->generation = generation;
+      m_table.store(next.get(), std::memory_order_release);
+      m_generation.store(generation, std::memory_order_release);
+      m_tables.push_back(std::move(next));
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+
+      auto oldest = generation;
+
+      for (auto slot = m_slots->head.load(std::memory_order_acquire); slot;
+           slot = slot->next)
+      {
+        const auto recorded = slot->generation.load(
+          std::memory_order_acquire
+        );
+
+        if (recorded != 0 && recorded < oldest)
+        {
+          oldest = recorded;
+        }
+      }
+      m_tables.erase(
+        std::begin(m_tables),
+        std::find_if(
+          std::begin(m_tables),
+          std::end(m_tables),
+          [oldest](const auto& retired)
+          {
+            return retired->generation >= oldest;
+          }
+        )
+      );
+    }
+
+  private:
+    /** Function used for loading time zones. */
+    const loader_type m_loader;
+    /** Currently published table of loaded time zones. */
+    std::atomic<const table*> m_table;
+    /** Generation of the currently published table. */
+    std::atomic<std::uint64_t> m_generation;
+    /** Reader slots of the threads which look up zones. */
+    const std::shared_ptr<slot_list> m_slots;
+    /** Lock shared by threads which modify the registry. */
+    std::mutex m_mutex;
+    /**
+     * Replaced tables which may still be in use by readers, followed by
+     * the currently published one, in order of generation.
+     */
+    std::vector<std::unique_ptr<const table>> m_tables;
+  };
+}
@@ -51,93 +51,46 @@ namespace peelo::chrono
     sat = 6
   };
 
-  weekday operator-(const weekday&, int);
-  weekday& operator-=(weekday&, int);
-
   /**
    * Increments weekday by given amount of days.
    */
-  inline weekday operator+(const weekday& original, int delta)
+  constexpr weekday operator+(const weekday& original, int delta) noexcept
   {
-    if (delta >= 0)
-    {
-      int result = static_cast<int>(original);
-
-      for (int i = 0; i < delta; ++i)
-      {
-        result = result < 6 ? result + 1 : 0;
-      }
-
-      return static_cast<weekday>(result);
-    }
-
-    return original - (-delta);
+    return static_cast<weekday>(
+      (static_cast<int>(original) + delta % 7 + 7) % 7
+    );
   }
 
   /**
    * Decrements weekday by given amount of days.
    */
-  inline weekday operator-(const weekday& original, int delta)
+  constexpr weekday operator-(const weekday& original, int delta) noexcept
   {
-    if (delta >= 0)
-    {
-      int result = static_cast<int>(original);
-
-      for (int i = 0; i < delta; ++i)
-      {
-        result = result > 0 ? result - 1 : 6;
-      }
-
-      return static_cast<weekday>(result);
-    }
-
-    return original + (-delta);
+    return static_cast<weekday>(
+      (static_cast<int>(original) - delta % 7 + 7) % 7
+    );
   }
 
   /**
    * Adds given number of days into the weekday.
    */
-  inline weekday& operator+=(weekday& original, int delta)
+  constexpr weekday& operator+=(weekday& original, int delta) noexcept
   {
-    if (delta >= 0)
-    {
-      int result = static_cast<int>(original);
-
-      for (int i = 0; i < delta; ++i)
-      {
-        result = result < 6 ? result + 1 : 0;
-      }
-
-      return original = static_cast<weekday>(result);
-    }
-
-    return original -= (-delta);
+    return original = original + delta;
   }
 
   /**
    * Substracts given number of days from the weekday.
    */
-  inline weekday& operator-=(weekday& original, int delta)
+  constexpr weekday& operator-=(weekday& original, int delta) noexcept
   {
-    if (delta >= 0)
-    {
-      int result = static_cast<int>(original);
-
-      for (int i = 0; i < delta; ++i)
-      {
-        result = result > 0 ? result - 1 : 6;
-      }
-
-      return original = static_cast<weekday>(result);
-    }
-
-    return original += (-delta);
+    return original = original - delta;
   }
 
   /**
    * Increments weekday by one, wrapping to Sunday if the weekday is Monday.
    */
-  inline weekday& operator++(weekday& original)
+  constexpr weekday& operator++(weekday& original) noexcept
   {
     return original += 1;
   }
@@ -145,7 +98,7 @@ namespace peelo::chrono
   /**
    * Decrements weekday by one, wrapping to Monday if the weekday is Sunday.
    */
-  inline weekday& operator--(weekday& original)
+  constexpr weekday& operator--(weekday& original) noexcept
   {
     return original -= 1;
   }
@@ -153,7 +106,7 @@ namespace peelo::chrono
   /**
    * Increments weekday by one, wrapping to Sunday if the weekday is Monday.
    */
-  inline weekday operator++(weekday& original, int)
+  constexpr weekday operator++(weekday& original, int) noexcept
   {
     const weekday return_value = original;
 
@@ -165,7 +118,7 @@ namespace peelo::chrono
   /**
    * Decrements weekday by one, wrapping to Monday if the weekday is Sunday.
    */
-  inline weekday operator--(weekday& original, int)
+  constexpr weekday operator--(weekday& original, int) noexcept
   {
     const weekday return_value = original;
 
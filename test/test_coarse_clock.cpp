@@ -0,0 +1,67 @@
+#include <peelo/chrono/coarse_clock.hpp>
+#include <peelo/chrono/datetime.hpp>
+#include <cassert>
+
+static void test_now()
+{
+  using namespace peelo;
+
+  const auto coarse = chrono::coarse_clock::now();
+  const auto system = std::chrono::system_clock::now();
+  const auto difference = std::chrono::duration_cast<std::chrono::seconds>(
+    system - coarse
+  ).count();
+
+  assert(difference >= -1 && difference <= 1);
+  assert(chrono::coarse_clock::now() >= coarse);
+}
+
+static void test_datetime_now()
+{
+  using namespace peelo;
+
+  for (int i = 0; i < 1000; ++i)
+  {
+    const auto now = chrono::datetime::now<chrono::coarse_clock>();
+
+    assert(chrono::datetime::is_valid(
+      now.year(),
+      now.month(),
+      now.day(),
+      now.hour(),
+      now.minute(),
+      now.second(),
+      now.nanosecond()
+    ));
+  }
+
+  const auto today = chrono::date::today<chrono::coarse_clock>();
+  const auto time = chrono::time::now<chrono::coarse_clock>();
+
+  assert(chrono::date::is_valid(today.year(), today.month(), today.day()));
+  assert(chrono::time::is_valid(
+    time.hour(),
+    time.minute(),
+    time.second(),
+    time.nanosecond()
+  ));
+}
+
+static void test_from_sys_time()
+{
+  using namespace peelo;
+
+  const auto now = chrono::coarse_clock::now();
+  const auto dt = chrono::datetime::from_sys_time(now);
+
+  assert(dt.to_sys_time() == now);
+}
+
+int main()
+{
+  test_now();
+  test_datetime_now();
+  test_from_sys_time();
+
+  return 0;
+}
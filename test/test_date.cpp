@@ -1,5 +1,7 @@
 #include <peelo/chrono/date.hpp>
 #include <cassert>
+#include <limits>
+#include <stdexcept>
 
 int main()
 {
@@ -13,7 +15,21 @@ int main()
   assert(date.day_of_week() == chrono::weekday::mon);
   assert(date.day_of_year() == 202);
   assert(date.days_in_month() == 31);
-  assert(date.timestamp() == -16761600L);
+  assert(date.timestamp() == -14169600L);
+  assert(
+    chrono::date(1600, chrono::month::mar, 1).timestamp() == -11670912000L
+  );
+  assert(
+    chrono::date(2300, chrono::month::dec, 31).timestamp() == 10445241600L
+  );
+  assert(
+    chrono::date(2147483647, chrono::month::dec, 31).timestamp() ==
+    INT64_C(67767976233446400)
+  );
+  assert(
+    chrono::date(-2147483647 - 1, chrono::month::jan, 1).timestamp() ==
+    INT64_C(-67768100567971200)
+  );
 
   assert(date.equals(1969, chrono::month::jul, 21));
   assert(date.compare(1969, chrono::month::jul, 20) > 0);
@@ -21,11 +37,191 @@ int main()
 
   assert(date + 5 == chrono::date(1969, chrono::month::jul, 26));
   assert(date - 5 == chrono::date(1969, chrono::month::jul, 16));
+  assert(date + -500000 == chrono::date(600, chrono::month::aug, 7));
+  assert(
+    chrono::date(1970, chrono::month::jan, 1) + 1000000 ==
+    chrono::date(4707, chrono::month::nov, 29)
+  );
+  assert(
+    chrono::date(2000, chrono::month::feb, 28) + 1 ==
+    chrono::date(2000, chrono::month::feb, 29)
+  );
+  assert(
+    chrono::date(2100, chrono::month::mar, 1) - 1 ==
+    chrono::date(2100, chrono::month::feb, 28)
+  );
+
+  auto copy = chrono::date(2023, chrono::month::mar, 1);
+
+  --copy;
+  assert(copy == chrono::date(2023, chrono::month::feb, 28));
+  copy += 366;
+  assert(copy == chrono::date(2024, chrono::month::feb, 29));
+  copy -= 59;
+  assert(copy == chrono::date(2024, chrono::month::jan, 1));
+
+  assert(
+    chrono::date::epoch_day(0) == chrono::date(1970, chrono::month::jan, 1)
+  );
+  assert(chrono::date(1600, chrono::month::jan, 1).epoch_day() == -135140);
+  assert(chrono::date(2300, chrono::month::dec, 31).epoch_day() == 120894);
 
   assert(date.format("%d.%m.%Y") == "21.07.1969");
   assert(chrono::to_string(date) == "21 Jul 1969");
   assert((chrono::date(1986, chrono::month::sep, 27) - date).days() == 6277);
 
+  static_assert(
+    chrono::date(1969, chrono::month::jul, 21).day_of_week() ==
+    chrono::weekday::mon
+  );
+  static_assert(
+    chrono::date(2000, chrono::month::feb, 29).day_of_week() ==
+    chrono::weekday::tue
+  );
+  static_assert(
+    chrono::date(1600, chrono::month::jan, 1).day_of_week() ==
+    chrono::weekday::sat
+  );
+  static_assert(
+    chrono::date(1969, chrono::month::dec, 28).day_of_week() ==
+    chrono::weekday::sun
+  );
+
+  constexpr chrono::date cutoff(2024, chrono::month::dec, 31);
+
+  static_assert(cutoff.day_of_year() == 366);
+  static_assert(cutoff + 1 == chrono::date(2025, chrono::month::jan, 1));
+  static_assert(cutoff - 365 == chrono::date(2024, chrono::month::jan, 1));
+  static_assert(cutoff.timestamp() == 1735603200);
+  static_assert(
+    (cutoff - chrono::date(2024, chrono::month::jan, 1)).days() == 365
+  );
+  static_assert(!chrono::date::is_valid(2023, chrono::month::feb, 29));
+
+  static_assert(
+    chrono::date(1969, chrono::month::jul, 20).to_sys_days()
+    .time_since_epoch().count() == -165
+  );
+  static_assert(
+    chrono::date::from_sys_days(chrono::sys_days(
+      chrono::sys_days::duration(19723)
+    )) == chrono::date(2024, chrono::month::jan, 1)
+  );
+
+#if defined(__cpp_lib_chrono) && __cpp_lib_chrono >= 201907L
+  static_assert(
+    chrono::date(2024, chrono::month::feb, 29).to_year_month_day() ==
+    std::chrono::year(2024) / std::chrono::February / 29
+  );
+  static_assert(
+    *chrono::date::make(std::chrono::year(2024) / std::chrono::March / 1) ==
+    chrono::date(2024, chrono::month::mar, 1)
+  );
+  static_assert(
+    !chrono::date::make(std::chrono::year(2023) / std::chrono::February / 29)
+  );
+#endif
+
+  static_assert(
+    chrono::date::from_utc_timestamp(-14169600) ==
+    chrono::date(1969, chrono::month::jul, 21)
+  );
+  static_assert(
+    chrono::date::from_utc_timestamp(-1) ==
+    chrono::date(1969, chrono::month::dec, 31)
+  );
+  static_assert(
+    chrono::date::from_utc_timestamp(1735689599) ==
+    chrono::date(2024, chrono::month::dec, 31)
+  );
+  static_assert(
+    chrono::date(2024, chrono::month::dec, 31).to_utc_timestamp() ==
+    1735603200
+  );
+  static_assert(
+    chrono::date::from_utc_timestamp(INT64_C(67767976233532799)) ==
+    chrono::date(2147483647, chrono::month::dec, 31)
+  );
+  static_assert(
+    chrono::date::from_utc_timestamp(INT64_C(-67768100567971200)) ==
+    chrono::date(-2147483647 - 1, chrono::month::jan, 1)
+  );
+
+  const auto timestamp_out_of_range = [](std::int64_t timestamp)
+  {
+    try
+    {
+      chrono::date::from_utc_timestamp(timestamp);
+    }
+    catch (const std::out_of_range&)
+    {
+      return true;
+    }
+
+    return false;
+  };
+
+  assert(timestamp_out_of_range(INT64_C(67767976233532800)));
+  assert(timestamp_out_of_range(INT64_C(-67768100567971201)));
+  assert(timestamp_out_of_range(std::numeric_limits<std::int64_t>::max()));
+  assert(timestamp_out_of_range(std::numeric_limits<std::int64_t>::min()));
+
+  char buffer[chrono::date::max_string_length];
+  auto result = chrono::to_chars(
+    buffer,
+    buffer + sizeof(buffer),
+    chrono::date(-2147483647 - 1, chrono::month::dec, 31)
+  );
+
+  assert(result.ec == std::errc());
+  assert(std::string(buffer, result.ptr) == "31 Dec -2147483648");
+  result = chrono::to_chars(buffer, buffer + 10, chrono::date(2024));
+  assert(result.ec == std::errc::value_too_large);
+  assert(result.ptr == buffer + 10);
+
+  static_assert(
+    *chrono::date::parse("2024-02-29") ==
+    chrono::date(2024, chrono::month::feb, 29)
+  );
+  static_assert(
+    chrono::date::parse("2023-02-29").error() == chrono::errc::invalid_day
+  );
+  static_assert(
+    chrono::date::parse("2023-00-01").error() == chrono::errc::invalid_month
+  );
+  static_assert(
+    chrono::date::parse("2023-1-01").error() == chrono::errc::invalid_format
+  );
+  static_assert(
+    chrono::date::parse("2023-01-01T").error() ==
+    chrono::errc::invalid_format
+  );
+
+  const char text[] = "1969-07-20T20:17:40Z";
+  chrono::date parsed;
+  const auto parse_result = chrono::from_chars(
+    text,
+    text + sizeof(text) - 1,
+    parsed
+  );
+
+  assert(parse_result.ec == std::errc());
+  assert(parse_result.ptr == text + 10);
+  assert(parsed == chrono::date(1969, chrono::month::jul, 20));
+  assert(
+    chrono::from_chars(text, text + 9, parsed).ec ==
+    std::errc::invalid_argument
+  );
+  assert(chrono::from_chars(text + 2, text + 12, parsed).ptr == text + 2);
+
+  const char invalid[] = "1969-02-30";
+
+  assert(
+    chrono::from_chars(invalid, invalid + 10, parsed).ec ==
+    std::errc::result_out_of_range
+  );
+  assert(parsed == chrono::date(1969, chrono::month::jul, 20));
+
   const auto today = chrono::date::today();
 
   assert(chrono::date::is_valid(
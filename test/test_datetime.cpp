@@ -1,5 +1,6 @@
 #include <peelo/chrono/datetime.hpp>
 #include <cassert>
+#include <stdexcept>
 
 int main()
 {
@@ -15,7 +16,11 @@ int main()
   assert(dt.second() == 0);
   assert(dt.day_of_week() == chrono::weekday::mon);
   assert(dt.day_of_year() == 202);
-  assert(dt.timestamp() == -16751040L);
+  assert(dt.timestamp() == -14159040L);
+  assert(
+    chrono::datetime(2300, chrono::month::dec, 31, 23, 59, 59).timestamp() ==
+    10445327999L
+  );
 
   assert(dt.equals(1969, chrono::month::jul, 21, 2, 56, 0));
   assert(dt.compare(1969, chrono::month::jul, 20, 2, 56, 0) > 0);
@@ -36,7 +41,190 @@ int main()
   );
 
   assert(dt.format("%d.%m.%Y %H:%M:%S") == "22.07.1969 02:56:00");
-  assert(chrono::to_string(dt) == "Sun, 22 Jul 1969 02:56:00 +0000");
+  assert(chrono::to_string(dt) == "Tue, 22 Jul 1969 02:56:00 +0000");
+
+  constexpr chrono::datetime launch(1969, chrono::month::jul, 16, 13, 32, 0);
+
+  static_assert(launch.day_of_week() == chrono::weekday::wed);
+  static_assert(launch.timestamp() == -14552880);
+  static_assert(
+    launch + 5 == chrono::datetime(1969, chrono::month::jul, 21, 13, 32, 0)
+  );
+  static_assert(launch < chrono::datetime(1969, chrono::month::jul, 21));
+  static_assert(
+    (chrono::datetime(1969, chrono::month::jul, 16, 14, 32, 0) - launch)
+    .hours() == 1
+  );
+
+  constexpr chrono::datetime precise(
+    1969,
+    chrono::month::jul,
+    20,
+    23,
+    59,
+    59,
+    750000000
+  );
+
+  static_assert(precise.millisecond() == 750);
+  static_assert(precise.nanosecond() == 750000000);
+  static_assert(
+    precise + chrono::duration::of_milliseconds(250) ==
+    chrono::datetime(1969, chrono::month::jul, 21)
+  );
+  static_assert(
+    chrono::datetime(1969, chrono::month::jul, 21) - precise ==
+    chrono::duration::of_milliseconds(250)
+  );
+  static_assert(
+    precise - chrono::duration::of_days(366) ==
+    chrono::datetime(1968, chrono::month::jul, 19, 23, 59, 59, 750000000)
+  );
+  assert(precise.format("%H:%M:%S.%f") == "23:59:59.750000");
+
+  static_assert(
+    chrono::datetime::from_sys_time(
+      chrono::sys_time<std::chrono::milliseconds>(
+        std::chrono::milliseconds(-14159040250)
+      )
+    ) == chrono::datetime(1969, chrono::month::jul, 21, 2, 55, 59, 750000000)
+  );
+  static_assert(
+    precise.to_sys_seconds().time_since_epoch().count() ==
+    precise.timestamp()
+  );
+  static_assert(
+    chrono::datetime::from_sys_time(precise.to_sys_time()) == precise
+  );
+
+  static_assert(
+    chrono::datetime::from_utc_timestamp(-14159040) ==
+    chrono::datetime(1969, chrono::month::jul, 21, 2, 56, 0)
+  );
+  static_assert(
+    chrono::datetime::from_utc_timestamp(-1) ==
+    chrono::datetime(1969, chrono::month::dec, 31, 23, 59, 59)
+  );
+  static_assert(
+    chrono::datetime::from_utc_timestamp(INT64_C(67767976233532799)) ==
+    chrono::datetime(2147483647, chrono::month::dec, 31, 23, 59, 59)
+  );
+
+  bool thrown = false;
+
+  try
+  {
+    chrono::datetime::from_utc_timestamp(INT64_C(67767976233532800));
+  }
+  catch (const std::out_of_range&)
+  {
+    thrown = true;
+  }
+  assert(thrown);
+  static_assert(
+    chrono::datetime(2300, chrono::month::dec, 31, 23, 59, 59)
+    .to_utc_timestamp() == 10445327999
+  );
+
+  char buffer[chrono::datetime::max_string_length];
+  const chrono::datetime longest(
+    -2147483647 - 1,
+    chrono::month::sep,
+    29,
+    23,
+    59,
+    59
+  );
+  const auto result = chrono::to_chars(
+    buffer,
+    buffer + sizeof(buffer),
+    longest
+  );
+
+  assert(result.ec == std::errc());
+  assert(result.ptr == buffer + sizeof(buffer));
+  assert(std::string(buffer, result.ptr) == chrono::to_string(longest));
+  assert(
+    chrono::to_chars(buffer, buffer + 5, longest).ec ==
+    std::errc::value_too_large
+  );
+
+  static_assert(
+    *chrono::datetime::parse("1969-07-22T02:56:00.25") ==
+    chrono::datetime(1969, chrono::month::jul, 22, 2, 56, 0, 250000000)
+  );
+  static_assert(
+    *chrono::datetime::parse("1969-07-22 02:56:00") ==
+    *chrono::datetime::parse("1969-07-22t02:56:00")
+  );
+  static_assert(
+    chrono::datetime::parse("1969-07-22").error() ==
+    chrono::errc::invalid_format
+  );
+  static_assert(
+    chrono::datetime::parse("1969-07-32T02:56:00").error() ==
+    chrono::errc::invalid_day
+  );
+  static_assert(
+    chrono::datetime::parse("1969-07-22T02:56:60").error() ==
+    chrono::errc::invalid_second
+  );
+  static_assert(
+    chrono::datetime::parse("1969-07-22T02:56:00Z").error() ==
+    chrono::errc::invalid_format
+  );
+
+  const char* const malformed[] =
+  {
+    "2024-07-04T12:00:0x",
+    "2024-07-04T12:00-00",
+    "2024-07-04T12;00:00",
+    "2024-07-04X12:00:00",
+    "2024/07-04T12:00:00",
+    "2024-07/04T12:00:00",
+    "20a4-07-04T12:00:00",
+    "2024-07-04T12:00:00.",
+    "2024-07-04T12:00:0",
+    "\xff" "024-07-04T12:00:00"
+  };
+
+  for (const auto input : malformed)
+  {
+    assert(
+      chrono::datetime::parse(input).error() == chrono::errc::invalid_format
+    );
+  }
+  assert(
+    *chrono::datetime::parse("9999-12-31T23:59:59.999999999") ==
+    chrono::datetime(9999, chrono::month::dec, 31, 23, 59, 59, 999999999)
+  );
+  assert(
+    *chrono::datetime::parse("0000-01-01 00:00:00") ==
+    chrono::datetime(0, chrono::month::jan, 1, 0, 0, 0)
+  );
+  assert(
+    chrono::datetime::parse("2023-02-29T00:00:00").error() ==
+    chrono::errc::invalid_day
+  );
+  assert(
+    chrono::datetime::parse("2023-12-01T25:00:00").error() ==
+    chrono::errc::invalid_hour
+  );
+
+  const char text[] = "{\"ts\":\"2024-02-29T13:05:09.123\"}";
+  chrono::datetime parsed;
+  const auto parse_result = chrono::from_chars(
+    text + 7,
+    text + sizeof(text) - 1,
+    parsed
+  );
+
+  assert(parse_result.ec == std::errc());
+  assert(*parse_result.ptr == '"');
+  assert(
+    parsed ==
+    chrono::datetime(2024, chrono::month::feb, 29, 13, 5, 9, 123000000)
+  );
 
   const auto now = chrono::datetime::now();
 
@@ -46,7 +234,8 @@ int main()
     now.day(),
     now.hour(),
     now.minute(),
-    now.second()
+    now.second(),
+    now.nanosecond()
   ));
 
   return 0;
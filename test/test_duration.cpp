@@ -201,6 +201,60 @@ static void test_assign_sub()
   assert(d.seconds() == 30);
 }
 
+static void test_constexpr()
+{
+  constexpr auto d = chrono::duration::of_hours(2) + 30;
+
+  static_assert(d.seconds() == 7230);
+  static_assert(d.minutes() == 120);
+  static_assert(d > chrono::duration::of_hours(2));
+  static_assert(d.compare(chrono::duration(7230)) == 0);
+}
+
+static void test_sub_second()
+{
+  const auto d = chrono::duration::of_milliseconds(-1500);
+
+  assert(d.seconds() == -2);
+  assert(d.nanosecond() == 500000000);
+  assert(d.milliseconds() == -1500);
+  assert(d.microseconds() == -1500000);
+  assert(d.nanoseconds() == -1500000000);
+  assert(-d == chrono::duration(1, 500000000));
+  assert(
+    chrono::duration::of_microseconds(999999) +
+    chrono::duration::of_nanoseconds(1000) ==
+    chrono::duration(1)
+  );
+  assert(chrono::duration(1) - chrono::duration(0, 1) < chrono::duration(1));
+  assert(chrono::duration(0, 1) > chrono::duration(0));
+}
+
+static void test_chrono()
+{
+  using namespace std::chrono_literals;
+
+  static_assert(
+    chrono::duration::from_chrono(-1500ms) ==
+    chrono::duration::of_milliseconds(-1500)
+  );
+  static_assert(
+    chrono::duration::from_chrono(std::chrono::hours(2)) ==
+    chrono::duration::of_hours(2)
+  );
+  static_assert(
+    chrono::duration::from_chrono(std::chrono::duration<double>(0.25)) ==
+    chrono::duration::of_milliseconds(250)
+  );
+  static_assert(
+    chrono::duration(3, 5).to_chrono() == 3s + std::chrono::nanoseconds(5)
+  );
+  assert(
+    chrono::duration::from_chrono(chrono::duration(-7, 1).to_chrono()) ==
+    chrono::duration(-7, 1)
+  );
+}
+
 int main()
 {
   test_constructor();
@@ -220,4 +274,7 @@ int main()
   test_sub();
   test_assign_add();
   test_assign_sub();
+  test_constexpr();
+  test_sub_second();
+  test_chrono();
 }
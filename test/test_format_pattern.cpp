@@ -0,0 +1,270 @@
+#include <peelo/chrono/offset_datetime.hpp>
+#include <cassert>
+#include <cstring>
+#include <iterator>
+#include <limits>
+
+static void test_fields()
+{
+  using namespace peelo;
+
+  chrono::format_pattern::fields fields;
+
+  fields.year = 2024;
+  fields.month = 2;
+  fields.day = 29;
+  fields.hour = 13;
+  fields.minute = 5;
+  fields.second = 9;
+  fields.nanosecond = 123456789;
+
+  assert(
+    chrono::format_pattern("%Y-%m-%dT%H:%M:%S.%N").render(fields) ==
+    "2024-02-29T13:05:09.123456789"
+  );
+  assert(
+    chrono::format_pattern("%a %A %b %B %e %j").render(fields) ==
+    "Thu Thursday Feb February 29 060"
+  );
+  assert(
+    chrono::format_pattern("%I:%M %p %P %u %w").render(fields) ==
+    "01:05 PM pm 4 4"
+  );
+  assert(
+    chrono::format_pattern("%C %y %D %F").render(fields) ==
+    "20 24 02/29/24 2024-02-29"
+  );
+  assert(chrono::format_pattern("%s").render(fields) == "1709211909");
+  assert(chrono::format_pattern("%Z").render(fields).empty());
+
+  fields.offset = -(3 * 3600 + 30 * 60);
+  fields.abbreviation = "NST";
+  assert(
+    chrono::format_pattern("%z %:z %Z").render(fields) == "-0330 -03:30 NST"
+  );
+  assert(chrono::format_pattern("%s").render(fields) == "1709224509");
+}
+
+static void test_week_numbers()
+{
+  using namespace peelo;
+
+  const chrono::format_pattern pattern("%G-W%V-%u %g %U %W");
+
+  assert(
+    chrono::date(2021, chrono::month::jan, 1).format(pattern) ==
+    "2020-W53-5 20 00 00"
+  );
+  assert(
+    chrono::date(2024, chrono::month::dec, 30).format(pattern) ==
+    "2025-W01-1 25 52 53"
+  );
+  assert(
+    chrono::date(2026, chrono::month::jan, 4).format(pattern) ==
+    "2026-W01-7 26 01 00"
+  );
+}
+
+static void test_literals()
+{
+  using namespace peelo;
+
+  chrono::format_pattern::fields fields;
+
+  assert(chrono::format_pattern("").render(fields).empty());
+  assert(chrono::format_pattern("plain text").render(fields) == "plain text");
+  assert(chrono::format_pattern("100%% %q%").render(fields) == "100% %q%");
+  assert(chrono::format_pattern("%n%t").render(fields) == "\n\t");
+  assert(chrono::format_pattern("%Ey %Od").render(fields) == "70 01");
+}
+
+static void test_types()
+{
+  using namespace peelo;
+
+  const chrono::format_pattern pattern("%c");
+  const chrono::datetime dt(1969, chrono::month::jul, 20, 20, 17, 40);
+
+  assert(dt.format(pattern) == "Sun Jul 20 20:17:40 1969");
+  assert(dt.date().format(pattern) == "Sun Jul 20 00:00:00 1969");
+  assert(dt.time().format("%r") == "08:17:40 PM");
+  assert(
+    chrono::offset_datetime(dt, 3600).format("%T%:z") == "20:17:40+01:00"
+  );
+
+  std::string output("> ");
+
+  pattern.render(dt.format_fields(), output);
+  assert(output == "> Sun Jul 20 20:17:40 1969");
+}
+
+static void test_years()
+{
+  using namespace peelo;
+
+  chrono::format_pattern::fields fields;
+  const chrono::format_pattern pattern("%Y %C %y");
+
+  fields.year = 33;
+  assert(pattern.render(fields) == "0033 00 33");
+  fields.year = 12345;
+  assert(pattern.render(fields) == "12345 123 45");
+  fields.year = -1;
+  assert(pattern.render(fields) == "-1 -1 99");
+}
+
+static void test_to_chars()
+{
+  using namespace peelo;
+
+  const chrono::format_pattern pattern("%F %T.%f");
+  const chrono::datetime dt(2024, chrono::month::feb, 29, 13, 5, 9, 123456789);
+  char buffer[32];
+  auto result = chrono::to_chars(
+    buffer,
+    buffer + sizeof(buffer),
+    dt,
+    pattern
+  );
+
+  assert(result.ec == std::errc());
+  assert(std::string(buffer, result.ptr) == "2024-02-29 13:05:09.123456");
+
+  result = chrono::to_chars(buffer, buffer + 26, dt, pattern);
+  assert(result.ec == std::errc());
+  assert(result.ptr == buffer + 26);
+
+  result = chrono::to_chars(buffer, buffer + 25, dt, pattern);
+  assert(result.ec == std::errc::value_too_large);
+  assert(result.ptr == buffer + 25);
+
+  result = chrono::to_chars(buffer, buffer, dt.time(), pattern);
+  assert(result.ec == std::errc::value_too_large);
+
+  std::string output;
+
+  chrono::format_to(std::back_inserter(output), dt.date(), pattern);
+  assert(output == "2024-02-29 00:00:00.000000");
+  output.clear();
+  chrono::format_to(
+    std::back_inserter(output),
+    chrono::offset_datetime(dt, 0),
+    chrono::format_pattern("%T%:z")
+  );
+  assert(output == "13:05:09+00:00");
+}
+
+static void test_max_length()
+{
+  using namespace peelo;
+
+  const chrono::datetime extremes[] =
+  {
+    chrono::datetime(-2147483647 - 1, chrono::month::jan, 1, 0, 0, 0),
+    chrono::datetime(
+      2147483647,
+      chrono::month::dec,
+      31,
+      23,
+      59,
+      59,
+      999999999
+    )
+  };
+  const char* expected_dates[] =
+  {
+    "01 Jan -2147483648",
+    "31 Dec 2147483647"
+  };
+  const char* expected_datetimes[] =
+  {
+    "Tue, 01 Jan -2147483648 00:00:00 +0000",
+    "Tue, 31 Dec 2147483647 23:59:59 +0000"
+  };
+  const chrono::format_pattern date_pattern("%d %b %Y");
+  const chrono::format_pattern datetime_pattern(
+    chrono::datetime::format_rfc2822
+  );
+  const chrono::format_pattern offset_pattern("%Y-%m-%dT%H:%M:%S%:z");
+
+  for (int i = 0; i < 2; ++i)
+  {
+    const auto& dt = extremes[i];
+    const chrono::offset_datetime odt(
+      dt,
+      -chrono::offset_datetime::max_offset
+    );
+    char date_buffer[chrono::date::max_string_length];
+    char datetime_buffer[chrono::datetime::max_string_length];
+
+    // Bounds of the built-in patterns fit into the advertised lengths, so
+    // that to_chars() writes straight into buffers of those lengths.
+    assert(
+      date_pattern.max_length(dt.date().format_fields()) <=
+      chrono::date::max_string_length
+    );
+    assert(
+      datetime_pattern.max_length(dt.format_fields()) <=
+      chrono::datetime::max_string_length
+    );
+    assert(
+      offset_pattern.max_length(odt.format_fields()) + 10 <=
+      chrono::offset_datetime::max_string_length
+    );
+
+    auto result = chrono::to_chars(
+      date_buffer,
+      date_buffer + sizeof(date_buffer),
+      dt.date()
+    );
+
+    assert(result.ec == std::errc());
+    assert(
+      std::string(date_buffer, result.ptr) == expected_dates[i]
+    );
+    result = chrono::to_chars(
+      datetime_buffer,
+      datetime_buffer + sizeof(datetime_buffer),
+      dt
+    );
+    assert(result.ec == std::errc());
+    assert(
+      std::string(datetime_buffer, result.ptr) == expected_datetimes[i]
+    );
+  }
+
+  // Out of range fields fall back to bounds covering any value.
+  chrono::format_pattern::fields fields;
+  const chrono::format_pattern all(
+    "%a %A %b %B %C %d %e %f %g %G %H %I %j %m %M %N %p %S %u %U %V %w %W "
+    "%y %Y %z %:z %%"
+  );
+
+  fields.year = std::numeric_limits<std::int64_t>::min() / 1000000;
+  fields.month = 13;
+  fields.day = -2147483647 - 1;
+  fields.hour = -2147483647 - 1;
+  fields.minute = 2147483647;
+  fields.second = -2147483647 - 1;
+  fields.offset = -2147483647 - 1;
+  assert(all.render(fields).length() <= all.max_length(fields));
+  fields = chrono::format_pattern::fields();
+  fields.year = std::numeric_limits<std::int64_t>::min() / 1000000;
+  fields.offset = 359999;
+  assert(all.render(fields).length() <= all.max_length(fields));
+  fields.year = 9999;
+  assert(all.render(fields).length() <= all.max_length(fields));
+}
+
+int main()
+{
+  test_fields();
+  test_week_numbers();
+  test_literals();
+  test_types();
+  test_years();
+  test_to_chars();
+  test_max_length();
+
+  return 0;
+}
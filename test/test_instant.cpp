@@ -0,0 +1,74 @@
+#include <cassert>
+
+#include <peelo/chrono/instant.hpp>
+
+using namespace peelo;
+
+static_assert(sizeof(chrono::instant) == 8);
+
+static void test_constructor()
+{
+  const chrono::datetime dt(1969, chrono::month::jul, 21, 2, 56, 15);
+  const chrono::instant i(dt);
+
+  assert(i.timestamp() == -14159025);
+  assert(i.datetime() == dt);
+  assert(chrono::instant().timestamp() == 0);
+  assert(
+    chrono::instant(chrono::date(1970, chrono::month::jan, 2)).timestamp()
+    == 86400
+  );
+}
+
+static void test_fields()
+{
+  const chrono::instant i(-1);
+
+  assert(i.year() == 1969);
+  assert(i.month() == chrono::month::dec);
+  assert(i.day() == 31);
+  assert(i.day_of_week() == chrono::weekday::wed);
+  assert(i.hour() == 23);
+  assert(i.minute() == 59);
+  assert(i.second() == 59);
+  assert(i.date() == chrono::date(1969, chrono::month::dec, 31));
+  assert(i.time() == chrono::time(23, 59, 59));
+  assert(chrono::to_string(i) == chrono::to_string(i.datetime()));
+}
+
+static void test_compare()
+{
+  const chrono::instant i1(100);
+  const chrono::instant i2(50);
+  const chrono::instant i3(150);
+
+  assert(i1 == chrono::instant(100));
+  assert(i1 != i2);
+  assert(i1.compare(i1) == 0);
+  assert(i1.compare(i2) == 1);
+  assert(i1.compare(i3) == -1);
+  assert(i2 < i1 && i1 < i3);
+  assert(i3 > i1 && i1 > i2);
+  assert(i1 <= i1 && i1 >= i1);
+}
+
+static void test_arithmetic()
+{
+  chrono::instant i(0);
+
+  i += chrono::duration::of_days(1);
+  assert(i.timestamp() == 86400);
+  i -= chrono::duration::of_hours(1);
+  assert(i.timestamp() == 82800);
+  assert((i + chrono::duration(10)).timestamp() == 82810);
+  assert((i - chrono::duration(10)).timestamp() == 82790);
+  assert((i - chrono::instant(800)).seconds() == 82000);
+}
+
+int main()
+{
+  test_constructor();
+  test_fields();
+  test_compare();
+  test_arithmetic();
+}
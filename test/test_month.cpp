@@ -1,5 +1,6 @@
 #include <peelo/chrono/month.hpp>
 #include <cassert>
+#include <climits>
 
 int main()
 {
@@ -12,6 +13,24 @@ int main()
   assert(chrono::month::jan + 13 == chrono::month::feb);
   assert(chrono::month::nov - 13 == chrono::month::oct);
 
+  assert(chrono::month::jan + 1000000 == chrono::month::may);
+  assert(chrono::month::jan - 1000000 == chrono::month::sep);
+  assert(chrono::month::mar + -14 == chrono::month::jan);
+  assert(chrono::month::dec + INT_MAX == chrono::month::jul);
+  assert(chrono::month::dec - INT_MIN == chrono::month::aug);
+
+  auto month = chrono::month::feb;
+
+  month += -3;
+  assert(month == chrono::month::nov);
+  month -= -3;
+  assert(month == chrono::month::feb);
+  month += 25;
+  assert(month == chrono::month::mar);
+
+  static_assert(chrono::month::jan + 3 == chrono::month::apr);
+  static_assert(chrono::month::nov - 13 == chrono::month::oct);
+
   assert(chrono::to_string(chrono::month::jan) == "January");
   assert(chrono::to_string(chrono::month::oct) == "October");
 
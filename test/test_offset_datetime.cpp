@@ -0,0 +1,256 @@
+#include <cassert>
+#include <stdexcept>
+
+#include <peelo/chrono/offset_datetime.hpp>
+
+using namespace peelo;
+
+static void test_constructor()
+{
+  const chrono::offset_datetime dt(
+    chrono::datetime(2024, chrono::month::jul, 4, 12, 0, 0),
+    -4 * 3600
+  );
+
+  assert(dt.datetime().hour() == 12);
+  assert(dt.offset() == -14400);
+  assert(
+    dt.to_utc() == chrono::datetime(2024, chrono::month::jul, 4, 16, 0, 0)
+  );
+  assert(dt.timestamp() == 1720108800);
+  assert(dt.to_instant().timestamp() == 1720108800);
+
+  bool thrown = false;
+
+  try
+  {
+    chrono::offset_datetime(chrono::datetime(), 86400);
+  }
+  catch (const std::invalid_argument&)
+  {
+    thrown = true;
+  }
+  assert(thrown);
+  assert(
+    chrono::offset_datetime::make(chrono::datetime(), -86400).error() ==
+    chrono::errc::invalid_offset
+  );
+}
+
+static void test_conversions()
+{
+  constexpr auto utc = chrono::datetime(2024, chrono::month::jan, 1, 1, 30, 0);
+  constexpr auto dt = chrono::offset_datetime::from_utc(utc, -5 * 3600);
+
+  static_assert(
+    dt.datetime() ==
+    chrono::datetime(2023, chrono::month::dec, 31, 20, 30, 0)
+  );
+  static_assert(dt.to_utc() == utc);
+  static_assert(
+    dt.with_offset(19800).datetime() ==
+    chrono::datetime(2024, chrono::month::jan, 1, 7, 0, 0)
+  );
+  static_assert(dt.with_offset(19800) == dt);
+  assert(
+    chrono::offset_datetime::from_instant(chrono::instant(0), 3600)
+    .datetime() == chrono::datetime(1970, chrono::month::jan, 1, 1, 0, 0)
+  );
+}
+
+static void test_compare()
+{
+  const chrono::offset_datetime a(
+    chrono::datetime(2024, chrono::month::jul, 4, 12, 0, 0),
+    -4 * 3600
+  );
+  const chrono::offset_datetime b(
+    chrono::datetime(2024, chrono::month::jul, 4, 18, 0, 0),
+    2 * 3600
+  );
+  const chrono::offset_datetime c(
+    chrono::datetime(2024, chrono::month::jul, 4, 16, 0, 0, 1),
+    0
+  );
+
+  assert(a == b);
+  assert(a.compare(b) == 0);
+  assert(a < c);
+  assert(c > b);
+  assert(c >= a);
+  assert(a != c);
+  assert((c - a) == chrono::duration(0, 1));
+  assert(
+    a + chrono::duration::of_hours(13) ==
+    chrono::offset_datetime(
+      chrono::datetime(2024, chrono::month::jul, 5, 1, 0, 0),
+      -4 * 3600
+    )
+  );
+}
+
+static void test_format()
+{
+  const chrono::offset_datetime dt(
+    chrono::datetime(2024, chrono::month::jul, 4, 12, 0, 0),
+    5 * 3600 + 30 * 60
+  );
+
+  assert(dt.format("%H:%M %z") == "12:00 +0530");
+  assert(dt.format("%H:%M %:z %%z") == "12:00 +05:30 %z");
+  assert(chrono::to_string(dt) == "2024-07-04T12:00:00+05:30");
+  assert(
+    chrono::to_string(chrono::offset_datetime(
+      chrono::datetime(1969, chrono::month::jul, 20, 20, 17, 40, 500000000),
+      0
+    )) == "1969-07-20T20:17:40.5+00:00"
+  );
+  assert(chrono::offset_datetime::format_offset(-3600) == "-01:00");
+  assert(chrono::offset_datetime::format_offset(-3600, false) == "-0100");
+  assert(chrono::offset_datetime::format_offset(5949) == "+01:39:09");
+
+  char buffer[chrono::offset_datetime::max_string_length];
+  const chrono::offset_datetime longest(
+    chrono::datetime(-2147483647 - 1, chrono::month::dec, 31, 23, 59, 59, 1),
+    -chrono::offset_datetime::max_offset
+  );
+  const auto result = chrono::to_chars(
+    buffer,
+    buffer + sizeof(buffer),
+    longest
+  );
+
+  assert(result.ec == std::errc());
+  assert(result.ptr == buffer + sizeof(buffer));
+  assert(
+    std::string(buffer, result.ptr) ==
+    "-2147483648-12-31T23:59:59.000000001-23:59:59"
+  );
+  assert(
+    chrono::to_chars(buffer, buffer + 20, longest).ec ==
+    std::errc::value_too_large
+  );
+  assert(
+    chrono::to_chars(buffer, buffer + sizeof(buffer) - 1, longest).ec ==
+    std::errc::value_too_large
+  );
+  assert(chrono::to_chars(buffer, buffer, longest).ec != std::errc());
+
+  char widest_buffer[
+    chrono::offset_datetime::max_unchecked_string_length
+  ];
+  const chrono::offset_datetime widest(
+    chrono::unchecked,
+    longest.datetime(),
+    -2147483647 - 1
+  );
+  const auto widest_result = chrono::to_chars(
+    widest_buffer,
+    widest_buffer + sizeof(widest_buffer),
+    widest
+  );
+
+  assert(widest_result.ec == std::errc());
+  assert(
+    std::string(widest_buffer, widest_result.ptr) ==
+    "-2147483648-12-31T23:59:59.000000001-596523:14:08"
+  );
+  assert(
+    chrono::to_string(widest) ==
+    "-2147483648-12-31T23:59:59.000000001-596523:14:08"
+  );
+  assert(
+    chrono::to_chars(buffer, buffer + sizeof(buffer), widest).ec ==
+    std::errc::value_too_large
+  );
+}
+
+static void test_parse()
+{
+  constexpr auto dt = chrono::offset_datetime::parse(
+    "2024-07-04T12:00:00.123456789-04:00"
+  );
+
+  static_assert(dt.has_value());
+  static_assert(dt->offset() == -14400);
+  static_assert(
+    dt->datetime() ==
+    chrono::datetime(2024, chrono::month::jul, 4, 12, 0, 0, 123456789)
+  );
+
+  assert(
+    *chrono::offset_datetime::parse("2024-07-04 16:00:00Z") ==
+    *chrono::offset_datetime::parse("2024-07-04t18:00:00+02:00")
+  );
+  assert(
+    chrono::offset_datetime::parse("2024-07-04T12:00:00.5z")->datetime()
+    .millisecond() == 500
+  );
+  assert(
+    chrono::offset_datetime::parse("2024-07-04T12:00:00.1234567891Z")
+    ->datetime().nanosecond() == 123456789
+  );
+  assert(
+    chrono::offset_datetime::parse("2024-07-04T12:00:00").error() ==
+    chrono::errc::invalid_format
+  );
+  assert(
+    chrono::offset_datetime::parse("2024-07-04T12:00Z").error() ==
+    chrono::errc::invalid_format
+  );
+  assert(
+    chrono::offset_datetime::parse("2024-13-04T12:00:00Z").error() ==
+    chrono::errc::invalid_month
+  );
+  assert(
+    chrono::offset_datetime::parse("2023-02-29T12:00:00Z").error() ==
+    chrono::errc::invalid_day
+  );
+  assert(
+    chrono::offset_datetime::parse("2024-07-04T24:00:00Z").error() ==
+    chrono::errc::invalid_hour
+  );
+  assert(
+    chrono::offset_datetime::parse("2024-07-04T12:00:00+24:00").error() ==
+    chrono::errc::invalid_offset
+  );
+
+  constexpr std::string_view text = "2024-07-04T12:00:00-04:00, next";
+  std::size_t position = 0;
+  const auto prefix = chrono::offset_datetime::parse(text, position);
+
+  assert(prefix.has_value());
+  assert(position == 25);
+  assert(prefix->offset() == -4 * 3600);
+
+  chrono::offset_datetime parsed;
+  auto result = chrono::from_chars(
+    text.data(),
+    text.data() + text.length(),
+    parsed
+  );
+
+  assert(result.ec == std::errc());
+  assert(result.ptr == text.data() + 25);
+  assert(parsed == *prefix);
+  result = chrono::from_chars(text.data(), text.data() + 19, parsed);
+  assert(result.ec == std::errc::invalid_argument);
+  assert(result.ptr == text.data());
+
+  static_assert(*chrono::offset_datetime::parse_offset("+05:30") == 19800);
+  static_assert(*chrono::offset_datetime::parse_offset("-0800") == -28800);
+  static_assert(*chrono::offset_datetime::parse_offset("+01") == 3600);
+  static_assert(*chrono::offset_datetime::parse_offset("Z") == 0);
+  static_assert(!chrono::offset_datetime::parse_offset("05:30"));
+  static_assert(!chrono::offset_datetime::parse_offset("+5:30"));
+  static_assert(!chrono::offset_datetime::parse_offset("+05:30x"));
+}
+
+int main()
+{
+  test_constructor();
+  test_conversions();
+  test_compare();
+  test_format();
+  test_parse();
+}
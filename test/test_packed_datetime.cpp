@@ -0,0 +1,94 @@
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <unordered_set>
+#include <vector>
+
+#include <peelo/chrono/packed_datetime.hpp>
+
+using namespace peelo;
+
+static_assert(sizeof(chrono::packed_datetime) == 8);
+static_assert(std::is_trivially_copyable_v<chrono::packed_datetime>);
+
+static void test_constructor()
+{
+  const chrono::datetime dt(1969, chrono::month::jul, 21, 2, 56, 7);
+  const chrono::packed_datetime packed(dt);
+
+  assert(packed.year() == 1969);
+  assert(packed.month() == chrono::month::jul);
+  assert(packed.day() == 21);
+  assert(packed.hour() == 2);
+  assert(packed.minute() == 56);
+  assert(packed.second() == 7);
+  assert(packed.datetime() == dt);
+  assert(packed.timestamp() == dt.timestamp());
+  assert(chrono::packed_datetime(packed.value()) == packed);
+  assert(chrono::packed_datetime().datetime() == chrono::datetime());
+}
+
+static void test_negative_year()
+{
+  const chrono::datetime dt(-44, chrono::month::mar, 15, 12, 0, 0);
+  const chrono::packed_datetime packed(dt);
+
+  assert(packed.year() == -44);
+  assert(packed.datetime() == dt);
+}
+
+static void test_order()
+{
+  std::vector<chrono::datetime> values = {
+    chrono::datetime(2024, chrono::month::jan, 1, 0, 0, 0),
+    chrono::datetime(-1, chrono::month::dec, 31, 23, 59, 59),
+    chrono::datetime(2023, chrono::month::dec, 31, 23, 59, 59),
+    chrono::datetime(0, chrono::month::jan, 1, 0, 0, 0),
+    chrono::datetime(2023, chrono::month::dec, 31, 23, 59, 58),
+    chrono::datetime(1970, chrono::month::jan, 1, 0, 0, 1),
+  };
+  std::vector<chrono::packed_datetime> packed;
+
+  for (const auto& value : values)
+  {
+    packed.emplace_back(value);
+  }
+  std::sort(std::begin(values), std::end(values));
+  std::sort(std::begin(packed), std::end(packed));
+  for (std::size_t i = 0; i < values.size(); ++i)
+  {
+    assert(packed[i].datetime() == values[i]);
+  }
+
+  assert(packed[0].compare(packed[1]) == -1);
+  assert(packed[1].compare(packed[0]) == 1);
+  assert(packed[0].compare(packed[0]) == 0);
+}
+
+static void test_hash()
+{
+  std::unordered_set<chrono::packed_datetime> set;
+
+  set.insert(chrono::packed_datetime(chrono::datetime(2024)));
+  set.insert(chrono::packed_datetime(chrono::datetime(2024)));
+  set.insert(chrono::packed_datetime(chrono::datetime(2025)));
+  assert(set.size() == 2);
+}
+
+static void test_atomic()
+{
+  std::atomic<chrono::packed_datetime> value;
+  const chrono::packed_datetime packed(chrono::datetime(2024));
+
+  value.store(packed);
+  assert(value.load() == packed);
+}
+
+int main()
+{
+  test_constructor();
+  test_negative_year();
+  test_order();
+  test_hash();
+  test_atomic();
+}
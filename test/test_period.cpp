@@ -0,0 +1,207 @@
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+#include <peelo/chrono/datetime.hpp>
+
+using namespace peelo;
+
+static void test_constructor()
+{
+  constexpr chrono::period p(1, 2, 3);
+
+  static_assert(p.years() == 1);
+  static_assert(p.months() == 2);
+  static_assert(p.days() == 3);
+  static_assert(p.total_months() == 14);
+  static_assert(chrono::period::of_years(2).total_months() == 24);
+  static_assert(chrono::period::of_months(5).months() == 5);
+  static_assert(chrono::period::of_days(7).days() == 7);
+}
+
+static void test_operators()
+{
+  constexpr chrono::period p(1, 2, 3);
+
+  static_assert(p == chrono::period(1, 2, 3));
+  static_assert(p != chrono::period(1, 2, 4));
+  static_assert(-p == chrono::period(-1, -2, -3));
+  static_assert(p + p == chrono::period(2, 4, 6));
+  static_assert(p - p == chrono::period());
+}
+
+static void test_add_months()
+{
+  const chrono::date d(2023, chrono::month::jan, 31);
+
+  assert(d.add_months(1) == chrono::date(2023, chrono::month::feb, 28));
+  assert(
+    d.add_months(1, chrono::overflow_policy::overflow) ==
+    chrono::date(2023, chrono::month::mar, 3)
+  );
+  assert(d.add_months(13) == chrono::date(2024, chrono::month::feb, 29));
+  assert(d.add_months(-1) == chrono::date(2022, chrono::month::dec, 31));
+  assert(d.add_months(-25) == chrono::date(2020, chrono::month::dec, 31));
+  assert(
+    d.add_months(1200000) == chrono::date(102023, chrono::month::jan, 31)
+  );
+  assert(d.add_months(0) == d);
+
+  bool thrown = false;
+
+  try
+  {
+    d.add_months(1, chrono::overflow_policy::error);
+  }
+  catch (const std::invalid_argument&)
+  {
+    thrown = true;
+  }
+  assert(thrown);
+}
+
+static void test_add_years()
+{
+  const chrono::date d(2024, chrono::month::feb, 29);
+
+  assert(d.add_years(4) == chrono::date(2028, chrono::month::feb, 29));
+  assert(d.add_years(1) == chrono::date(2025, chrono::month::feb, 28));
+  assert(
+    d.add_years(1, chrono::overflow_policy::overflow) ==
+    chrono::date(2025, chrono::month::mar, 1)
+  );
+  assert(d.add_years(-124) == chrono::date(1900, chrono::month::feb, 28));
+}
+
+static bool throws_out_of_range(
+  const chrono::date& date,
+  std::int64_t months,
+  std::int64_t years
+)
+{
+  try
+  {
+    date.add_months(months).add_years(years);
+  }
+  catch (const std::out_of_range&)
+  {
+    return true;
+  }
+
+  return false;
+}
+
+static void test_add_out_of_range()
+{
+  const chrono::date d(2024, chrono::month::jan, 31);
+  const auto min = std::numeric_limits<std::int64_t>::min();
+  const auto max = std::numeric_limits<std::int64_t>::max();
+
+  assert(
+    d.add_years(2147483647 - 2024) ==
+    chrono::date(2147483647, chrono::month::jan, 31)
+  );
+  assert(
+    d.add_months(-12 * (INT64_C(2147483648) + 2024)) ==
+    chrono::date(-2147483647 - 1, chrono::month::jan, 31)
+  );
+  assert(throws_out_of_range(d, 0, 2147483648 - 2024));
+  assert(throws_out_of_range(d, -12 * (INT64_C(2147483648) + 2025), 0));
+  assert(throws_out_of_range(d, max, 0));
+  assert(throws_out_of_range(d, min, 0));
+  assert(throws_out_of_range(d, 0, max));
+  assert(throws_out_of_range(d, 0, min));
+  assert(!throws_out_of_range(d, 1, 1));
+}
+
+static void test_add_period()
+{
+  constexpr chrono::date d(2024, chrono::month::jan, 31);
+
+  static_assert(
+    d + chrono::period(1, 1, 1) == chrono::date(2025, chrono::month::mar, 1)
+  );
+  static_assert(
+    d - chrono::period(0, 2, 0) == chrono::date(2023, chrono::month::nov, 30)
+  );
+
+  auto copy = d;
+
+  copy += chrono::period::of_months(1);
+  assert(copy == chrono::date(2024, chrono::month::feb, 29));
+  copy -= chrono::period::of_years(1);
+  assert(copy == chrono::date(2023, chrono::month::feb, 28));
+}
+
+static void test_period_out_of_range()
+{
+  const chrono::date d(2024, chrono::month::jan, 31);
+  const chrono::datetime dt(d, chrono::time(12, 0, 0));
+  const auto years = chrono::period::of_years(
+    std::numeric_limits<int>::max()
+  );
+  int thrown = 0;
+
+  try
+  {
+    static_cast<void>(d + years);
+  }
+  catch (const std::out_of_range&)
+  {
+    ++thrown;
+  }
+  try
+  {
+    static_cast<void>(dt - years - years);
+  }
+  catch (const std::out_of_range&)
+  {
+    ++thrown;
+  }
+  try
+  {
+    auto copy = dt;
+
+    copy += years;
+  }
+  catch (const std::out_of_range&)
+  {
+    ++thrown;
+  }
+  assert(thrown == 3);
+}
+
+static void test_datetime()
+{
+  const chrono::datetime dt(2024, chrono::month::mar, 31, 12, 30, 0);
+
+  assert(
+    dt.add_months(1) ==
+    chrono::datetime(2024, chrono::month::apr, 30, 12, 30, 0)
+  );
+  assert(
+    dt.add_years(-1) ==
+    chrono::datetime(2023, chrono::month::mar, 31, 12, 30, 0)
+  );
+  assert(
+    dt + chrono::period(0, 1, 1) ==
+    chrono::datetime(2024, chrono::month::may, 1, 12, 30, 0)
+  );
+  assert(
+    dt.add(chrono::period::of_months(-1), chrono::overflow_policy::overflow)
+    == chrono::datetime(2024, chrono::month::mar, 2, 12, 30, 0)
+  );
+}
+
+int main()
+{
+  test_constructor();
+  test_operators();
+  test_add_months();
+  test_add_years();
+  test_add_out_of_range();
+  test_add_period();
+  test_period_out_of_range();
+  test_datetime();
+}
@@ -0,0 +1,97 @@
+#include <cassert>
+
+#include <peelo/chrono/datetime.hpp>
+
+using namespace peelo;
+
+static void test_date_make()
+{
+  const auto valid = chrono::date::make(2024, chrono::month::feb, 29);
+  const auto invalid = chrono::date::make(2023, chrono::month::feb, 29);
+
+  assert(valid.has_value());
+  assert(valid.error() == chrono::errc::ok);
+  assert(*valid == chrono::date(2024, chrono::month::feb, 29));
+  assert(valid->day() == 29);
+
+  assert(!invalid);
+  assert(invalid.error() == chrono::errc::invalid_day);
+  assert(invalid.value_or(chrono::date(2000)) == chrono::date(2000));
+  assert(
+    chrono::date::make(2023, static_cast<chrono::month>(12), 1).error()
+    == chrono::errc::invalid_month
+  );
+}
+
+static void test_time_make()
+{
+  assert(chrono::time::make(23, 59, 59).value() == chrono::time(23, 59, 59));
+  assert(chrono::time::make(24, 0, 0).error() == chrono::errc::invalid_hour);
+  assert(
+    chrono::time::make(0, 60, 0).error() == chrono::errc::invalid_minute
+  );
+  assert(
+    chrono::time::make(0, 0, -1).error() == chrono::errc::invalid_second
+  );
+}
+
+static void test_datetime_make()
+{
+  assert(
+    chrono::datetime::make(2024, chrono::month::jan, 1, 12, 0, 0).value()
+    == chrono::datetime(2024, chrono::month::jan, 1, 12, 0, 0)
+  );
+  assert(
+    chrono::datetime::make(2024, chrono::month::jan, 32, 12, 0, 0).error()
+    == chrono::errc::invalid_day
+  );
+  assert(
+    chrono::datetime::make(2024, chrono::month::jan, 1, 12, 0, 60).error()
+    == chrono::errc::invalid_second
+  );
+}
+
+static void test_value_throws()
+{
+  bool thrown = false;
+
+  try
+  {
+    chrono::time::make(25, 0, 0).value();
+  }
+  catch (const std::invalid_argument&)
+  {
+    thrown = true;
+  }
+  assert(thrown);
+}
+
+static void test_unchecked()
+{
+  constexpr chrono::datetime dt(
+    chrono::unchecked,
+    2024,
+    chrono::month::mar,
+    10,
+    8,
+    30,
+    0
+  );
+
+  static_assert(dt.day() == 10);
+  static_assert(dt.minute() == 30);
+  static_assert(
+    chrono::date::validate(2024, chrono::month::feb, 30)
+    == chrono::errc::invalid_day
+  );
+  static_assert(chrono::date::make(2024, chrono::month::feb, 29).has_value());
+}
+
+int main()
+{
+  test_date_make();
+  test_time_make();
+  test_datetime_make();
+  test_value_throws();
+  test_unchecked();
+}
@@ -0,0 +1,94 @@
+#include <cassert>
+
+#include <peelo/chrono/serial_date.hpp>
+
+using namespace peelo;
+
+static_assert(sizeof(chrono::serial_date) == 4);
+
+static void test_constructor()
+{
+  const auto epoch = chrono::serial_date();
+  const auto d = chrono::serial_date(
+    chrono::date(1969, chrono::month::jul, 21)
+  );
+
+  assert(epoch.days() == 0);
+  assert(epoch.date() == chrono::date(1970, chrono::month::jan, 1));
+  assert(d.days() == -164);
+  assert(d.date() == chrono::date(1969, chrono::month::jul, 21));
+}
+
+static void test_out_of_range()
+{
+  bool thrown = false;
+
+  try
+  {
+    chrono::serial_date(chrono::date(6000000, chrono::month::jan, 1));
+  }
+  catch (const std::out_of_range&)
+  {
+    thrown = true;
+  }
+  assert(thrown);
+}
+
+static void test_fields()
+{
+  const auto d = chrono::serial_date(
+    chrono::date(2024, chrono::month::feb, 29)
+  );
+
+  assert(d.year() == 2024);
+  assert(d.month() == chrono::month::feb);
+  assert(d.day() == 29);
+  assert(d.day_of_week() == chrono::weekday::thu);
+  assert(d.timestamp() == 1709164800);
+  assert(chrono::to_string(d) == "29 Feb 2024");
+}
+
+static void test_compare()
+{
+  const auto d1 = chrono::serial_date(100);
+  const auto d2 = chrono::serial_date(50);
+  const auto d3 = chrono::serial_date(150);
+
+  assert(d1 == chrono::serial_date(100));
+  assert(d1 != d2);
+
+  assert(d1.compare(d1) == 0);
+  assert(d1.compare(d2) == 1);
+  assert(d1.compare(d3) == -1);
+
+  assert(d2 < d1 && d1 < d3);
+  assert(d3 > d1 && d1 > d2);
+  assert(d1 <= d1 && d1 >= d1);
+}
+
+static void test_arithmetic()
+{
+  auto d = chrono::serial_date(chrono::date(2023, chrono::month::dec, 31));
+
+  ++d;
+  assert(d.date() == chrono::date(2024, chrono::month::jan, 1));
+  d--;
+  assert(d.date() == chrono::date(2023, chrono::month::dec, 31));
+  d += 60;
+  assert(d.date() == chrono::date(2024, chrono::month::feb, 29));
+  d -= 60;
+  assert(d.date() == chrono::date(2023, chrono::month::dec, 31));
+
+  assert((d + 1).date() == chrono::date(2024, chrono::month::jan, 1));
+  assert((d - 365).date() == chrono::date(2022, chrono::month::dec, 31));
+  assert((d - chrono::serial_date(0)).days() == d.days());
+}
+
+int main()
+{
+  test_constructor();
+  test_out_of_range();
+  test_fields();
+  test_compare();
+  test_arithmetic();
+}
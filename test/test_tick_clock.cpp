@@ -0,0 +1,123 @@
+#include <peelo/chrono/tick_clock.hpp>
+#include <cassert>
+
+static void test_now()
+{
+  using namespace peelo;
+
+  auto previous = chrono::tick_clock::now();
+
+  for (int i = 0; i < 1000; ++i)
+  {
+    const auto current = chrono::tick_clock::now();
+
+    assert(current >= previous);
+    previous = current;
+  }
+}
+
+static void test_calibration()
+{
+  using namespace peelo;
+
+  // The tick length of a refined calibration is measured against the
+  // steady clock between the two anchors, so converting the ticks between
+  // the anchors must give a duration within steady clock samples taken
+  // around and inside that window.
+  const auto outer_first = std::chrono::steady_clock::now();
+  const auto first = chrono::tick_calibration::measure(
+    std::chrono::milliseconds(1)
+  );
+  const auto inner_first = std::chrono::steady_clock::now();
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+  const auto inner_last = std::chrono::steady_clock::now();
+  const auto last = first.refine();
+  const auto outer_last = std::chrono::steady_clock::now();
+  const auto elapsed = last.to_duration(
+    first.anchor_ticks(),
+    last.anchor_ticks()
+  ).to_chrono();
+  const std::chrono::nanoseconds rounding(1);
+
+  assert(last.nanoseconds_per_tick() > 0);
+  assert(last.anchor_ticks() > first.anchor_ticks());
+  assert(elapsed + rounding >= inner_last - inner_first);
+  assert(elapsed <= outer_last - outer_first + rounding);
+  assert(
+    last.to_duration(last.anchor_ticks(), first.anchor_ticks()) ==
+    -last.to_duration(first.anchor_ticks(), last.anchor_ticks())
+  );
+}
+
+static void test_monotonic()
+{
+  using namespace peelo;
+
+  const auto calibration = chrono::tick_clock::calibration();
+  const auto first = chrono::tick_clock::now();
+  auto previous = first;
+
+  for (int i = 0; i < 1000; ++i)
+  {
+    const auto current = chrono::tick_clock::now();
+
+    assert(
+      calibration.to_duration(first, current) >=
+      calibration.to_duration(first, previous)
+    );
+    assert(
+      calibration.to_sys_time(current) >= calibration.to_sys_time(previous)
+    );
+    previous = current;
+  }
+}
+
+static void test_to_sys_time()
+{
+  using namespace peelo;
+
+  // The anchor of a fresh calibration pairs the ticks with a system clock
+  // reading, which must fall between readings taken around it.
+  const auto before = std::chrono::system_clock::now();
+  const auto calibration = chrono::tick_clock::recalibrate();
+  const auto after = std::chrono::system_clock::now();
+  const auto anchor = calibration.to_sys_time(calibration.anchor_ticks());
+  const auto ticks = chrono::tick_clock::now();
+
+  assert(anchor >= before && anchor <= after);
+  assert(calibration.to_sys_time(ticks) >= anchor);
+  assert(
+    calibration.to_datetime(ticks) ==
+    chrono::datetime::from_sys_time(calibration.to_sys_time(ticks))
+  );
+}
+
+static void test_recalibrate()
+{
+  using namespace peelo;
+
+  const auto before = chrono::tick_clock::calibration();
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+  const auto after = chrono::tick_clock::recalibrate();
+
+  assert(after.anchor_ticks() > before.anchor_ticks());
+  assert(after.nanoseconds_per_tick() > 0);
+  assert(
+    chrono::tick_clock::calibration().anchor_ticks() == after.anchor_ticks()
+  );
+}
+
+int main()
+{
+  test_now();
+  test_calibration();
+  test_monotonic();
+  test_to_sys_time();
+  test_recalibrate();
+
+  return 0;
+}
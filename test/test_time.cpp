@@ -32,9 +32,129 @@ int main()
   assert(time.format("%H:%M:%S") == "22:59:00");
   assert(chrono::to_string(time) == "22:59:00");
 
+  constexpr chrono::time noon(12, 0, 0);
+
+  static_assert(noon.hour() == 12);
+  static_assert(noon + 90 == chrono::time(12, 1, 30));
+  static_assert(noon - 3600 == chrono::time(11, 0, 0));
+  static_assert(noon.compare(11, 59, 59) > 0);
+  static_assert(chrono::time::is_valid(23, 59, 59));
+  static_assert(!chrono::time::is_valid(24, 0, 0));
+
+  static_assert(sizeof(chrono::time) == 8);
+  static_assert(chrono::time(0, 0, 0) - 1 == chrono::time(23, 59, 59));
+  static_assert(chrono::time(23, 0, 0) + 7200 == chrono::time(1, 0, 0));
+  static_assert(chrono::time(1, 2, 3).second_of_day() == 3723);
+  static_assert(chrono::time::second_of_day(-1) == chrono::time(23, 59, 59));
+
+  time = chrono::time(0, 0, 30);
+  time -= 86400 * 3 + 60;
+  assert(time.equals(23, 59, 30));
+  time += 2000000000;
+  assert(time.equals(3, 32, 50));
+
+  std::int64_t days = 0;
+
+  assert(
+    chrono::time(22, 0, 0).add_seconds(3 * 3600, days) ==
+    chrono::time(1, 0, 0)
+  );
+  assert(days == 1);
+  assert(
+    chrono::time(1, 0, 0).add_seconds(-2 * 86400 - 7200, days) ==
+    chrono::time(23, 0, 0)
+  );
+  assert(days == -3);
+  assert(chrono::time(12, 0, 0).add_seconds(0, days).hour() == 12);
+  assert(days == 0);
+
+  constexpr chrono::time precise(10, 20, 30, 123456789);
+
+  static_assert(precise.millisecond() == 123);
+  static_assert(precise.microsecond() == 123456);
+  static_assert(precise.nanosecond() == 123456789);
+  static_assert(precise.second_of_day() == 37230);
+  static_assert(precise > chrono::time(10, 20, 30));
+  static_assert(precise.compare(10, 20, 30, 123456790) < 0);
+  static_assert(
+    chrono::time::nanosecond_of_day(-1) ==
+    chrono::time(23, 59, 59, 999999999)
+  );
+  static_assert(
+    !chrono::time::make(0, 0, 0, 1000000000).has_value()
+  );
+  static_assert(
+    chrono::time::validate(0, 0, 0, -1) == chrono::errc::invalid_nanosecond
+  );
+  static_assert(
+    precise + chrono::duration::of_milliseconds(877) ==
+    chrono::time(10, 20, 31, 456789)
+  );
+  static_assert(
+    chrono::time(0, 0, 0, 500) - chrono::duration::of_nanoseconds(1000) ==
+    chrono::time(23, 59, 59, 999999500)
+  );
+  assert(precise.format("%T.%f") == "10:20:30.123456");
+  assert(precise.format("%S.%N %%f") == "30.123456789 %f");
+
+  assert(
+    chrono::time(23, 59, 59, 999999999).add(
+      chrono::duration::of_nanoseconds(1),
+      days
+    ) == chrono::time(0, 0, 0)
+  );
+  assert(days == 1);
+  assert(
+    chrono::time(0, 0, 0, 1).add(chrono::duration(0, -2), days) ==
+    chrono::time(23, 59, 59, 999999999)
+  );
+  assert(days == -1);
+
+  static_assert(*chrono::time::parse("23:59:59") == chrono::time(23, 59, 59));
+  static_assert(
+    *chrono::time::parse("00:00:00.000000001") == chrono::time(0, 0, 0, 1)
+  );
+  static_assert(
+    *chrono::time::parse("12:30:00.1234567899") ==
+    chrono::time(12, 30, 0, 123456789)
+  );
+  static_assert(
+    chrono::time::parse("24:00:00").error() == chrono::errc::invalid_hour
+  );
+  static_assert(
+    chrono::time::parse("12:60:00").error() == chrono::errc::invalid_minute
+  );
+  static_assert(
+    chrono::time::parse("12:00").error() == chrono::errc::invalid_format
+  );
+  static_assert(
+    chrono::time::parse("12:00:00.").error() == chrono::errc::invalid_format
+  );
+  static_assert(
+    chrono::time::parse("12:00:0a").error() == chrono::errc::invalid_format
+  );
+
+  const char text[] = "08:15:30.5+02:00";
+  chrono::time parsed;
+  const auto parse_result = chrono::from_chars(
+    text,
+    text + sizeof(text) - 1,
+    parsed
+  );
+
+  assert(parse_result.ec == std::errc());
+  assert(parse_result.ptr == text + 10);
+  assert(parsed == chrono::time(8, 15, 30, 500000000));
+  assert(chrono::to_string(*chrono::time::parse("08:15:30")) == "08:15:30");
+
   const auto now = chrono::time::now();
 
-  assert(chrono::time::is_valid(now.hour(), now.minute(), now.second()));
+  assert(chrono::time::is_valid(
+    now.hour(),
+    now.minute(),
+    now.second(),
+    now.nanosecond()
+  ));
 
   return 0;
 }
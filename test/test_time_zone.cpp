@@ -0,0 +1,394 @@
+#include <cassert>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include <peelo/chrono/time_zone.hpp>
+
+using namespace peelo;
+
+static std::int64_t utc(
+  int year,
+  chrono::month month,
+  int day,
+  int hour = 0,
+  int minute = 0,
+  int second = 0
+)
+{
+  return chrono::datetime(year, month, day, hour, minute, second)
+    .timestamp();
+}
+
+static void put32(std::vector<unsigned char>& data, std::uint32_t value)
+{
+  for (int shift = 24; shift >= 0; shift -= 8)
+  {
+    data.push_back(static_cast<unsigned char>(value >> shift));
+  }
+}
+
+static void put64(std::vector<unsigned char>& data, std::int64_t value)
+{
+  put32(data, static_cast<std::uint32_t>(
+    static_cast<std::uint64_t>(value) >> 32
+  ));
+  put32(data, static_cast<std::uint32_t>(value));
+}
+
+static void put_block(std::vector<unsigned char>& data, bool is_64bit)
+{
+  const char abbreviations[] = "EET\0EEST";
+
+  data.insert(data.end(), { 'T', 'Z', 'i', 'f', '2' });
+  data.insert(data.end(), 15, 0);
+  put32(data, 0);
+  put32(data, 0);
+  put32(data, 0);
+  put32(data, 2);
+  put32(data, 2);
+  put32(data, sizeof(abbreviations));
+  for (const std::int64_t time : { 1000000000, 1010000000 })
+  {
+    if (is_64bit)
+    {
+      put64(data, time);
+    } else {
+      put32(data, static_cast<std::uint32_t>(time));
+    }
+  }
+  data.insert(data.end(), { 1, 0 });
+  put32(data, 7200);
+  data.insert(data.end(), { 0, 0 });
+  put32(data, 10800);
+  data.insert(data.end(), { 1, 4 });
+  data.insert(
+    data.end(),
+    abbreviations,
+    abbreviations + sizeof(abbreviations)
+  );
+}
+
+static void test_posix()
+{
+  const auto zone = chrono::time_zone::from_posix("EST5EDT,M3.2.0,M11.1.0");
+
+  assert(zone.name() == "EST5EDT,M3.2.0,M11.1.0");
+  assert(zone.offset(utc(2024, chrono::month::mar, 10, 6, 59, 59)) == -18000);
+  assert(zone.offset(utc(2024, chrono::month::mar, 10, 7)) == -14400);
+  assert(zone.offset(utc(2024, chrono::month::nov, 3, 5, 59, 59)) == -14400);
+  assert(zone.offset(utc(2024, chrono::month::nov, 3, 6)) == -18000);
+  assert(zone.lookup(utc(2024, chrono::month::jan, 1)).abbreviation == "EST");
+  assert(zone.lookup(utc(2024, chrono::month::jul, 1)).abbreviation == "EDT");
+  assert(zone.lookup(utc(2024, chrono::month::jul, 1)).is_dst);
+
+  assert(
+    zone.to_local(chrono::datetime(2024, chrono::month::jul, 4, 16, 0, 0))
+    == chrono::datetime(2024, chrono::month::jul, 4, 12, 0, 0)
+  );
+  assert(
+    zone.to_local(chrono::datetime(2024, chrono::month::jan, 1, 3, 0, 0, 5))
+    == chrono::datetime(2023, chrono::month::dec, 31, 22, 0, 0, 5)
+  );
+  assert(
+    zone.to_utc(chrono::datetime(2024, chrono::month::jul, 4, 12, 0, 0))
+    == chrono::datetime(2024, chrono::month::jul, 4, 16, 0, 0)
+  );
+
+  // Ambiguous local time resolves to the earlier instant.
+  assert(
+    zone.to_utc(chrono::datetime(2024, chrono::month::nov, 3, 1, 30, 0))
+    == chrono::datetime(2024, chrono::month::nov, 3, 5, 30, 0)
+  );
+
+  // Non-existent local time is shifted forward by the gap.
+  assert(
+    zone.to_utc(chrono::datetime(2024, chrono::month::mar, 10, 2, 30, 0))
+    == chrono::datetime(2024, chrono::month::mar, 10, 7, 30, 0)
+  );
+}
+
+static void test_posix_southern()
+{
+  const auto zone = chrono::time_zone::from_posix(
+    "AEST-10AEDT,M10.1.0,M4.1.0/3"
+  );
+
+  assert(zone.offset(utc(2024, chrono::month::jan, 15)) == 39600);
+  assert(zone.offset(utc(2024, chrono::month::jul, 1)) == 36000);
+  assert(zone.offset(utc(2024, chrono::month::apr, 6, 15, 59, 59)) == 39600);
+  assert(zone.offset(utc(2024, chrono::month::apr, 6, 16)) == 36000);
+  assert(zone.offset(utc(2024, chrono::month::oct, 5, 15, 59, 59)) == 36000);
+  assert(zone.offset(utc(2024, chrono::month::oct, 5, 16)) == 39600);
+}
+
+static void test_posix_day_rules()
+{
+  const auto zone = chrono::time_zone::from_posix("XXX0YYY,J60/0,300/0");
+
+  assert(zone.offset(utc(2024, chrono::month::feb, 29, 23, 59, 59)) == 0);
+  assert(zone.offset(utc(2024, chrono::month::mar, 1)) == 3600);
+  assert(zone.offset(utc(2024, chrono::month::oct, 26, 22, 59, 59)) == 3600);
+  assert(zone.offset(utc(2024, chrono::month::oct, 26, 23)) == 0);
+
+  const auto quoted = chrono::time_zone::from_posix("<+0330>-3:30");
+
+  assert(quoted.offset(0) == 12600);
+  assert(quoted.lookup(0).abbreviation == "+0330");
+
+  const auto us = chrono::time_zone::from_posix("CST6CDT");
+
+  assert(us.offset(utc(2024, chrono::month::jul, 1)) == -18000);
+  assert(us.offset(utc(2024, chrono::month::dec, 1)) == -21600);
+}
+
+static void test_posix_invalid()
+{
+  for (const auto rule : { "", "ES5", "EST", "EST5EDT,M13.1.0,M11.1.0",
+                           "EST5EDT,M3.2.0", "EST5EDT,M3.2.0,M11.1.0x" })
+  {
+    bool thrown = false;
+
+    try
+    {
+      chrono::time_zone::from_posix(rule);
+    }
+    catch (const std::invalid_argument&)
+    {
+      thrown = true;
+    }
+    assert(thrown);
+  }
+}
+
+static void test_utc()
+{
+  const auto zone = chrono::time_zone::utc();
+
+  assert(zone.name() == "UTC");
+  assert(zone.offset(-14159040) == 0);
+  assert(zone.lookup(1700000000).abbreviation == "UTC");
+  assert(!zone.lookup(1700000000).is_dst);
+}
+
+static void test_tzif()
+{
+  std::vector<unsigned char> data;
+
+  put_block(data, false);
+  put_block(data, true);
+  for (const char c : std::string("\nEET-2EEST,M3.5.0/3,M10.5.0/4\n"))
+  {
+    data.push_back(static_cast<unsigned char>(c));
+  }
+
+  const auto zone = chrono::time_zone::from_tzif(
+    "Test/Zone",
+    data.data(),
+    data.size()
+  );
+
+  assert(zone.name() == "Test/Zone");
+  assert(zone.offset(999999999) == 7200);
+  assert(zone.offset(1000000000) == 10800);
+  assert(zone.lookup(1000000000).abbreviation == "EEST");
+  assert(zone.offset(1009999999) == 10800);
+  assert(zone.offset(1010000000) == 7200);
+  assert(zone.lookup(1010000000).abbreviation == "EET");
+  assert(zone.offset(utc(2024, chrono::month::jul, 1)) == 10800);
+  assert(zone.offset(utc(2024, chrono::month::jan, 1)) == 7200);
+  assert(
+    zone.to_local(chrono::instant(1000000000))
+    == chrono::datetime(2001, chrono::month::sep, 9, 4, 46, 40)
+  );
+
+  bool thrown = false;
+
+  try
+  {
+    chrono::time_zone::from_tzif("Test/Zone", data.data(), 60);
+  }
+  catch (const std::runtime_error&)
+  {
+    thrown = true;
+  }
+  assert(thrown);
+}
+
+static void test_locate()
+{
+  if (!std::ifstream("/usr/share/zoneinfo/America/New_York"))
+  {
+    return;
+  }
+
+  const auto zone = chrono::time_zone::locate("America/New_York");
+
+  assert(zone.name() == "America/New_York");
+  assert(zone.offset(utc(1970, chrono::month::jan, 1)) == -18000);
+  assert(zone.offset(utc(2024, chrono::month::jul, 4, 16)) == -14400);
+  assert(zone.lookup(utc(2024, chrono::month::jul, 4, 16)).abbreviation ==
+    "EDT");
+  assert(zone.offset(utc(2100, chrono::month::jul, 1)) == -14400);
+  assert(zone.offset(utc(2100, chrono::month::dec, 1)) == -18000);
+
+  bool thrown = false;
+
+  try
+  {
+    chrono::time_zone::locate("../etc/passwd");
+  }
+  catch (const std::invalid_argument&)
+  {
+    thrown = true;
+  }
+  assert(thrown);
+
+  thrown = false;
+  try
+  {
+    chrono::time_zone::locate("No/Such_Zone");
+  }
+  catch (const std::runtime_error&)
+  {
+    thrown = true;
+  }
+  assert(thrown);
+}
+
+static void test_extremes(const chrono::time_zone& zone)
+{
+  const std::int64_t timestamps[] =
+  {
+    std::numeric_limits<std::int64_t>::min(),
+    std::numeric_limits<std::int64_t>::min() + 1,
+    std::numeric_limits<std::int64_t>::max() - 1,
+    std::numeric_limits<std::int64_t>::max()
+  };
+
+  for (const auto t : timestamps)
+  {
+    const auto type = zone.lookup(t);
+
+    assert(zone.offset(t) == type.offset);
+    assert(type.offset == zone.offset(t > 0 ? t - 86400 * 366 : t + 1));
+    assert(!type.abbreviation.empty());
+  }
+}
+
+static void test_extremes()
+{
+  test_extremes(chrono::time_zone::from_posix("EST5EDT,M3.2.0,M11.1.0"));
+  test_extremes(chrono::time_zone::from_posix("AEST-10AEDT,M10.1.0,M4.1.0/3"));
+
+  if (std::ifstream("/usr/share/zoneinfo/Europe/Helsinki"))
+  {
+    test_extremes(chrono::time_zone::locate("Europe/Helsinki"));
+  }
+}
+
+static void test_to_tzif()
+{
+  const auto zone = chrono::time_zone::from_posix("EST5EDT,M3.2.0,M11.1.0");
+  const auto data = zone.to_tzif();
+  const auto copy = chrono::time_zone::from_tzif(
+    "America/New_York",
+    data.data(),
+    data.size()
+  );
+
+  for (auto t = utc(2020, chrono::month::jan, 1);
+       t < utc(2030, chrono::month::jan, 1);
+       t += 3600)
+  {
+    assert(copy.offset(t) == zone.offset(t));
+    assert(copy.lookup(t).abbreviation == zone.lookup(t).abbreviation);
+  }
+  for (const auto t : {
+    std::numeric_limits<std::int64_t>::min(),
+    std::numeric_limits<std::int64_t>::max()
+  })
+  {
+    assert(copy.offset(t) == zone.offset(t));
+  }
+
+  if (!std::ifstream("/usr/share/zoneinfo/Europe/Helsinki"))
+  {
+    return;
+  }
+
+  const auto helsinki = chrono::time_zone::locate("Europe/Helsinki");
+  const auto first = utc(1990, chrono::month::jan, 1);
+  const auto last = utc(2000, chrono::month::jan, 1);
+  const auto trimmed = helsinki.to_tzif(first, last);
+  const auto trimmed_copy = chrono::time_zone::from_tzif(
+    "Europe/Helsinki",
+    trimmed.data(),
+    trimmed.size()
+  );
+
+  assert(trimmed.size() < helsinki.to_tzif().size());
+  for (auto t = first; t < utc(2040, chrono::month::jan, 1); t += 3600)
+  {
+    assert(trimmed_copy.offset(t) == helsinki.offset(t));
+  }
+}
+
+static void test_cache()
+{
+  const auto new_york = chrono::time_zone::from_posix(
+    "EST5EDT,M3.2.0,M11.1.0"
+  );
+  const auto sydney = chrono::time_zone::from_posix(
+    "AEST-10AEDT,M10.1.0,M4.1.0/3"
+  );
+  const auto transition = utc(2024, chrono::month::mar, 10, 7);
+
+  // Sorted stream crossing a transition, interleaved with another zone.
+  for (auto t = transition - 7200; t < transition + 7200; t += 60)
+  {
+    assert(new_york.offset(t) == (t < transition ? -18000 : -14400));
+    assert(sydney.offset(t) == 39600);
+    const auto dt = chrono::datetime::from_utc_timestamp(t);
+
+    assert(new_york.to_utc(new_york.to_local(dt)) == dt);
+  }
+
+  // Jumping backwards and far away after the cache has been filled.
+  assert(new_york.offset(utc(1990, chrono::month::jul, 1)) == -14400);
+  assert(new_york.offset(utc(2300, chrono::month::jan, 1)) == -18000);
+  assert(new_york.offset(transition - 1) == -18000);
+  assert(
+    new_york.to_utc(chrono::datetime(2024, chrono::month::nov, 3, 1, 30, 0))
+    == chrono::datetime(2024, chrono::month::nov, 3, 5, 30, 0)
+  );
+}
+
+#if defined(PEELO_CHRONO_EMBEDDED_TZDB)
+static void test_embedded()
+{
+  const auto zone = chrono::time_zone::locate(
+    chrono::embedded_tzdb::zones[0].name
+  );
+
+  assert(zone.name() == chrono::embedded_tzdb::zones[0].name);
+}
+#endif
+
+int main()
+{
+  test_posix();
+  test_posix_southern();
+  test_posix_day_rules();
+  test_posix_invalid();
+  test_utc();
+  test_tzif();
+  test_locate();
+  test_extremes();
+  test_to_tzif();
+  test_cache();
+#if defined(PEELO_CHRONO_EMBEDDED_TZDB)
+  test_embedded();
+#endif
+}
@@ -0,0 +1,156 @@
+#include <atomic>
+#include <cassert>
+#include <fstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <peelo/chrono/time_zone_registry.hpp>
+
+using namespace peelo;
+
+static void test_locate()
+{
+  int calls = 0;
+  chrono::time_zone_registry registry([&calls](const std::string& name)
+  {
+    ++calls;
+
+    return chrono::time_zone::from_posix(name);
+  });
+
+  assert(registry.size() == 0);
+  assert(!registry.find("EST5EDT"));
+
+  const auto& zone = registry.locate("EST5EDT");
+
+  assert(calls == 1);
+  assert(zone.name() == "EST5EDT");
+  assert(&registry.locate("EST5EDT") == &zone);
+  assert(registry.find("EST5EDT") == &zone);
+  assert(calls == 1);
+
+  registry.locate("CET-1CEST,M3.5.0,M10.5.0/3");
+  registry.locate("AEST-10AEDT,M10.1.0,M4.1.0/3");
+  assert(calls == 3);
+  assert(registry.size() == 3);
+  assert(registry.find("EST5EDT") == &zone);
+  assert(registry.find("CET-1CEST,M3.5.0,M10.5.0/3")->offset(0) == 3600);
+}
+
+static void test_locate_failure()
+{
+  chrono::time_zone_registry registry(chrono::time_zone::from_posix);
+  bool thrown = false;
+
+  try
+  {
+    registry.locate("invalid");
+  }
+  catch (const std::invalid_argument&)
+  {
+    thrown = true;
+  }
+  assert(thrown);
+  assert(registry.size() == 0);
+  assert(!registry.find("invalid"));
+}
+
+static void test_reload()
+{
+  int calls = 0;
+  chrono::time_zone_registry registry([&calls](const std::string& name)
+  {
+    ++calls;
+
+    return chrono::time_zone::from_posix(name);
+  });
+  const auto& old_zone = registry.locate("EST5EDT");
+
+  registry.locate("UTC0");
+  registry.reload();
+  assert(calls == 4);
+
+  // The zone stays valid until this thread looks up zones again.
+  assert(old_zone.name() == "EST5EDT");
+  assert(old_zone.offset(0) == -18000);
+
+  const auto& new_zone = registry.locate("EST5EDT");
+
+  assert(&new_zone != &old_zone);
+  assert(new_zone.offset(0) == -18000);
+  assert(registry.size() == 2);
+  assert(calls == 4);
+}
+
+static void test_concurrent_reload()
+{
+  static const char* const names[] =
+  {
+    "EST5EDT,M3.2.0,M11.1.0",
+    "CET-1CEST,M3.5.0,M10.5.0/3",
+    "AEST-10AEDT,M10.1.0,M4.1.0/3",
+    "UTC0"
+  };
+  static const std::int32_t offsets[] = { -18000, 3600, 39600, 0 };
+  chrono::time_zone_registry registry(chrono::time_zone::from_posix);
+  std::atomic<bool> done(false);
+  std::vector<std::thread> readers;
+
+  registry.locate(names[0]);
+  registry.locate(names[1]);
+  for (int i = 0; i < 4; ++i)
+  {
+    readers.emplace_back([&registry, &done, i]()
+    {
+      for (std::size_t j = 0; !done.load(); ++j)
+      {
+        const auto index = (i + j) % 4;
+        const auto zone = i % 2
+          ? registry.find(names[index])
+          : &registry.locate(names[index]);
+
+        if (zone)
+        {
+          assert(zone->name() == names[index]);
+          assert(zone->offset(0) == offsets[index]);
+        } else {
+          assert(index >= 2);
+        }
+      }
+    });
+  }
+  for (int i = 0; i < 1000 || registry.size() < 4; ++i)
+  {
+    registry.reload();
+  }
+  done.store(true);
+  for (auto& reader : readers)
+  {
+    reader.join();
+  }
+  assert(registry.size() == 4);
+}
+
+static void test_instance()
+{
+  auto& registry = chrono::time_zone_registry::instance();
+
+  assert(&registry == &chrono::time_zone_registry::instance());
+  if (std::ifstream("/usr/share/zoneinfo/Europe/Helsinki"))
+  {
+    const auto& zone = registry.locate("Europe/Helsinki");
+
+    assert(&registry.locate("Europe/Helsinki") == &zone);
+    assert(zone.offset(0) == 7200);
+  }
+}
+
+int main()
+{
+  test_locate();
+  test_locate_failure();
+  test_reload();
+  test_concurrent_reload();
+  test_instance();
+}
@@ -1,5 +1,6 @@
 #include <peelo/chrono/weekday.hpp>
 #include <cassert>
+#include <climits>
 
 int main()
 {
@@ -13,6 +14,22 @@ int main()
   assert(chrono::weekday::mon + 8 == chrono::weekday::tue);
   assert(chrono::weekday::sat - 11 == chrono::weekday::tue);
 
+  assert(chrono::weekday::sun + 1000000 == chrono::weekday::mon);
+  assert(chrono::weekday::sun - 1000000 == chrono::weekday::sat);
+  assert(chrono::weekday::wed + -10 == chrono::weekday::sun);
+  assert(chrono::weekday::sun + INT_MAX == chrono::weekday::mon);
+  assert(chrono::weekday::sun - INT_MIN == chrono::weekday::tue);
+
+  auto day = chrono::weekday::tue;
+
+  day += -3;
+  assert(day == chrono::weekday::sat);
+  day -= -3;
+  assert(day == chrono::weekday::tue);
+
+  static_assert(chrono::weekday::mon + 8 == chrono::weekday::tue);
+  static_assert(chrono::weekday::sat - 11 == chrono::weekday::tue);
+
   assert(chrono::to_string(chrono::weekday::mon) == "Monday");
   assert(chrono::to_string(chrono::weekday::fri) == "Friday");
 
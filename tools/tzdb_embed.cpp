@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2016-2024, peelo.net
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/*
+ * Generates C++ header which embeds time zone data into the library. Used by
+ * the build system when `PEELO_CHRONO_EMBEDDED_TZDB` option is enabled.
+ *
+ * Usage: tzdb_embed <output> <zoneinfo directory> <first year> <last year>
+ *                   <zone>...
+ */
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <set>
+
+#include <peelo/chrono/time_zone.hpp>
+
+using namespace peelo;
+
+static std::string identifier(std::size_t index)
+{
+  return "zone_data_" + std::to_string(index);
+}
+
+int main(int argc, char** argv)
+{
+  if (argc < 6)
+  {
+    std::cerr << "Usage: " << argv[0]
+              << " <output> <zoneinfo directory> <first year> <last year>"
+              << " <zone>..." << std::endl;
+
+    return EXIT_FAILURE;
+  }
+
+  const std::string directory = argv[2];
+  const auto first = chrono::date(std::atoi(argv[3])).timestamp();
+  const auto last = chrono::date(std::atoi(argv[4]) + 1).timestamp();
+  const std::set<std::string> names(argv + 5, argv + argc);
+  std::ofstream output(argv[1]);
+  std::size_t index = 0;
+
+  output << "// Generated by tzdb_embed, do not edit.\n"
+         << "#pragma once\n\n"
+         << "#include <cstddef>\n\n"
+         << "namespace peelo::chrono::embedded_tzdb\n{\n"
+         << "  struct zone\n  {\n"
+         << "    const char* name;\n"
+         << "    const unsigned char* data;\n"
+         << "    std::size_t size;\n"
+         << "  };\n";
+
+  for (const auto& name : names)
+  {
+    std::vector<unsigned char> data;
+
+    try
+    {
+      data = chrono::time_zone::from_file(
+        name,
+        directory + '/' + name
+      ).to_tzif(first, last);
+    }
+    catch (const std::exception& e)
+    {
+      std::cerr << name << ": " << e.what() << std::endl;
+
+      return EXIT_FAILURE;
+    }
+
+    output << "\n  inline constexpr unsigned char " << identifier(index++)
+           << "[] =\n  {";
+    for (std::size_t i = 0; i < data.size(); ++i)
+    {
+      output << (i % 12 ? " " : "\n    ") << static_cast<int>(data[i])
+             << (i + 1 < data.size() ? "," : "");
+    }
+    output << "\n  };\n";
+  }
+
+  output << "\n  inline constexpr zone zones[] =\n  {\n";
+  index = 0;
+  for (const auto& name : names)
+  {
+    const auto id = identifier(index++);
+
+    output << "    { \"" << name << "\", " << id << ", sizeof(" << id
+           << ") },\n";
+  }
+  output << "  };\n}\n";
+
+  if (!output)
+  {
+    std::cerr << argv[1] << ": unable to write output" << std::endl;
+
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}